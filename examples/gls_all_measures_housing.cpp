@@ -25,6 +25,7 @@
 #include <tesseract/base/init.hpp>
 #include <tesseract/io/HousingReader.hpp>
 #include <tesseract/preprocessor/DataGenerator.hpp>
+#include <tesseract/io/CovarianceCache.hpp>
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
 #include <tesseract/algorithm/ForwardRegression.hpp>
 #include <tesseract/algorithm/LocalSearch.hpp>
@@ -59,13 +60,17 @@ typedef GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntr
 typedef SmoothedDifferentialEntropy<float64_t>::param_type reg_param_type;
 typedef LocalSearch<SmoothedDifferentialEntropy,float64_t>::param_type ls_param_type;
 
-MatrixXd get_training_data_cov(index_t num_examples)
+CovarianceCache get_training_data_cache(index_t num_examples)
 {
 	DataGenerator<HousingReader, HousingReader, UnitL2Normalizer> gen(HousingDataSet::feat_train, HousingDataSet::label_train);
 	gen.set_seed(100);
 	gen.set_num_examples(num_examples);
-	gen.generate();
-	return gen.get_cov();
+
+	// the covariance matrix is cached in the data directory between runs and
+	// used right from the mapped file
+	CovarianceCache cache(CovarianceCache::get_filename("data", gen.get_cov_key()));
+	gen.generate_cov(cache);
+	return cache;
 }
 
 param_type get_params(float64_t eta, float64_t eps, float64_t delta)
@@ -151,7 +156,8 @@ int main(int argc, char** argv)
 	index_t max_feats = 10;
 
 	// store cov once and run the algo for different number of feats
-	MatrixXd cov = get_training_data_cov(num_examples);
+	CovarianceCache cache = get_training_data_cache(num_examples);
+	Map<const MatrixXd> cov = cache.get_cov();
 	param_type params = get_params(eta, eps, delta);
 
 	// generate testdata
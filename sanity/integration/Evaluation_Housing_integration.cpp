@@ -28,6 +28,9 @@
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
 #include <tesseract/algorithm/Dummy.hpp>
 #include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LazyForwardRegression.hpp>
+#include <tesseract/algorithm/StochasticForwardRegression.hpp>
+#include <tesseract/algorithm/OrthogonalMatchingPursuit.hpp>
 #include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/algorithm/LinearLocalSearch.hpp>
 #include <tesseract/algorithm/GreedyLocalSearch.hpp>
@@ -172,6 +175,42 @@ int main(int argc, char** argv)
 	std::cout << "============================================================================" << std::endl;
 	test<GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>,
 		SquaredMultipleCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 25: GLS(Lazy FR, LS, logdet regularizer) Sum-squared error" << std::endl;
+	std::cout << "=================================================================" << std::endl;
+	test<GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SumSquaredError<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 26: GLS(Lazy FR, LS, logdet regularizer) Pearson's correlation" << std::endl;
+	std::cout << "=====================================================================" << std::endl;
+	test<GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		PearsonsCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 27: GLS(Lazy FR, LS, logdet regularizer) Squared multiple correlation" << std::endl;
+	std::cout << "============================================================================" << std::endl;
+	test<GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SquaredMultipleCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 28: GLS(Stochastic FR, LS, logdet regularizer) Sum-squared error" << std::endl;
+	std::cout << "=======================================================================" << std::endl;
+	test<GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SumSquaredError<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 29: GLS(Stochastic FR, LS, logdet regularizer) Pearson's correlation" << std::endl;
+	std::cout << "===========================================================================" << std::endl;
+	test<GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		PearsonsCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 30: GLS(Stochastic FR, LS, logdet regularizer) Squared multiple correlation" << std::endl;
+	std::cout << "==================================================================================" << std::endl;
+	test<GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SquaredMultipleCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 31: GLS(OMP, LS, logdet regularizer) Sum-squared error" << std::endl;
+	std::cout << "============================================================" << std::endl;
+	test<GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SumSquaredError<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 32: GLS(OMP, LS, logdet regularizer) Pearson's correlation" << std::endl;
+	std::cout << "================================================================" << std::endl;
+	test<GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		PearsonsCorrelation<float64_t>>(num_examples, target_feats);
+	std::cout << "Test 33: GLS(OMP, LS, logdet regularizer) Squared multiple correlation" << std::endl;
+	std::cout << "=======================================================================" << std::endl;
+	test<GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		SquaredMultipleCorrelation<float64_t>>(num_examples, target_feats);
 
 	return 0;
 }
@@ -0,0 +1,120 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/io/HousingReader.hpp>
+#include <tesseract/preprocessor/DataGenerator.hpp>
+#include <tesseract/normalizer/UnitL2Normalizer.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LocalSearch.hpp>
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/errors/SquaredMultipleCorrelation.hpp>
+#include <tesseract/evaluation/Evaluation.hpp>
+#include <tesseract/evaluation/GridEvaluation.hpp>
+#include <tesseract/evaluation/ResultWriter.hpp>
+#include <tesseract/evaluation/DataSet.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cmath>
+
+using namespace tesseract;
+
+typedef DataGenerator<HousingReader,HousingReader,UnitL2Normalizer> generator_type;
+typedef GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t> algo_type;
+typedef algo_type::param_type param_type;
+
+int main(int argc, char** argv)
+{
+	logger.set_loglevel(None);
+
+	std::vector<int32_t> seeds = {12345, 100};
+	std::vector<index_t> num_examples = {100, 200};
+	std::vector<index_t> target_feats = {2, 4, 6};
+	std::vector<float64_t> etas = {0.1, 0.01};
+
+	GridEvaluation<HousingDataSet,generator_type,algo_type> grid;
+	grid.set_seeds(seeds);
+	grid.set_num_examples(num_examples);
+	grid.set_target_feats(target_feats);
+	grid.set_num_threads(4);
+	for (float64_t eta : etas)
+	{
+		grid.add_params(param_type(eta, SmoothedDifferentialEntropyParam<float64_t>()),
+				"eta=" + std::to_string(eta));
+	}
+
+	std::ostringstream out;
+	{
+		ResultWriter writer(out, CSV);
+		grid.run(writer);
+	}
+	std::cout << out.str();
+
+	// the results are in the order of the grid and the same as of Evaluation,
+	// which reuses its data until the seed or the number of examples changes
+	std::istringstream in(out.str());
+	std::string line;
+	std::getline(in, line);
+
+	Evaluation<HousingDataSet,generator_type,algo_type,
+		SquaredMultipleCorrelation<float64_t>> evaluator;
+
+	for (int32_t seed : seeds)
+	{
+		for (index_t n : num_examples)
+		{
+			for (float64_t eta : etas)
+			{
+				for (index_t k : target_feats)
+				{
+					evaluator.set_seed(seed);
+					evaluator.set_num_examples(n);
+					evaluator.set_target_feats(k);
+					evaluator.set_params(param_type(eta, SmoothedDifferentialEntropyParam<float64_t>()));
+					std::pair<index_t,float64_t> result = evaluator.evaluate();
+
+					assert(std::getline(in, line));
+					std::istringstream fields(line);
+					std::string field;
+					std::vector<std::string> values;
+					while (std::getline(fields, field, ','))
+						values.push_back(field);
+
+					assert(values.size() == 10);
+					assert(std::stoi(values[0]) == seed);
+					assert(std::stoul(values[1]) == n);
+					assert(values[2] == "eta=" + std::to_string(eta));
+					assert(std::stoul(values[3]) == k);
+					assert(std::stoul(values[4]) == result.first);
+					assert(std::abs(std::stod(values[9]) - result.second) < 1e-12);
+				}
+			}
+		}
+	}
+	assert(!std::getline(in, line));
+
+	return 0;
+}
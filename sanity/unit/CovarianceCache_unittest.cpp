@@ -0,0 +1,163 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/io/CovarianceCache.hpp>
+#include <tesseract/io/HousingReader.hpp>
+#include <tesseract/preprocessor/DataGenerator.hpp>
+#include <tesseract/normalizer/UnitL2Normalizer.hpp>
+#include <tesseract/evaluation/DataSet.hpp>
+#include <string>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace tesseract;
+
+std::string temp_filename()
+{
+	char filename[] = "/tmp/covXXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	close(fd);
+	std::remove(filename);
+	return filename;
+}
+
+void test1()
+{
+	std::string filename = temp_filename();
+
+	Matrix<float64_t> m = Matrix<float64_t>::Random(5, 5);
+	Matrix<float64_t> cov = m.transpose() * m;
+
+	CovarianceCache cache(filename);
+
+	// nothing is cached yet
+	assert(!cache.load("key"));
+
+	cache.store("key", cov);
+	assert(cache.load("key"));
+	assert(cache.get_cov() == cov);
+
+	// the matrix for another key is stale
+	assert(!cache.load("other key"));
+	assert(!cache.load("keys"));
+
+	// so is a truncated file
+	{
+		std::fstream fs(filename, std::ios::in | std::ios::out | std::ios::binary);
+		fs.seekg(0, std::ios::end);
+		index_t size = fs.tellg();
+		fs.close();
+		assert(truncate(filename.c_str(), size - 1) == 0);
+	}
+	assert(!cache.load("key"));
+
+	// and a file of another version
+	cache.store("key", cov);
+	{
+		std::fstream fs(filename, std::ios::in | std::ios::out | std::ios::binary);
+		fs.seekp(8);
+		fs.put(static_cast<char>(CovarianceCache::version + 1));
+		fs.close();
+	}
+	assert(!cache.load("key"));
+
+	std::remove(filename.c_str());
+}
+
+void test2()
+{
+	typedef DataGenerator<HousingReader, HousingReader, UnitL2Normalizer> Generator;
+
+	std::string filename = temp_filename();
+
+	Generator gen(HousingDataSet::feat_train, HousingDataSet::label_train);
+	gen.set_seed(100);
+	gen.set_num_examples(400);
+
+	Matrix<float64_t> expected;
+	gen.generate_cov(expected);
+
+	// the first run stores the matrix, the second one loads it, both times
+	// the matrix is mapped from the cache file
+	{
+		CovarianceCache cache(filename);
+		gen.generate_cov(cache);
+		assert(cache.get_cov() == expected);
+	}
+
+	CovarianceCache cache(filename);
+	assert(cache.load(gen.get_cov_key()));
+	assert(cache.get_cov() == expected);
+
+	gen.generate_cov(cache);
+	assert(cache.get_cov() == expected);
+
+	// a different seed gives a different key
+	Generator other_gen(HousingDataSet::feat_train, HousingDataSet::label_train);
+	other_gen.set_seed(101);
+	other_gen.set_num_examples(400);
+	assert(other_gen.get_cov_key() != gen.get_cov_key());
+	assert(!cache.load(other_gen.get_cov_key()));
+
+	std::remove(filename.c_str());
+}
+
+void test3()
+{
+	typedef DataGenerator<HousingReader, HousingReader, UnitL2Normalizer> Generator;
+
+	// a copy of the data set which can be modified
+	std::string data_filename = temp_filename();
+	{
+		std::ifstream is(HousingDataSet::feat_train, std::ios::binary);
+		std::ofstream os(data_filename, std::ios::binary);
+		os << is.rdbuf();
+	}
+
+	Generator gen(data_filename, data_filename);
+	gen.set_seed(100);
+	gen.set_num_examples(400);
+	std::string key = gen.get_cov_key();
+	assert(key == gen.get_cov_key());
+
+	// rewriting the data set under the same name gives a different key
+	{
+		std::ofstream os(data_filename, std::ios::binary | std::ios::app);
+		os << "\n";
+	}
+	assert(gen.get_cov_key() != key);
+
+	std::remove(data_filename.c_str());
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	test3();
+	return 0;
+}
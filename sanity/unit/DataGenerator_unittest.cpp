@@ -25,6 +25,7 @@
 #include <tesseract/io/IDX1Reader.hpp>
 #include <tesseract/io/IDX3Reader.hpp>
 #include <tesseract/io/FileReader.hpp>
+#include <tesseract/io/HousingReader.hpp>
 #include <tesseract/preprocessor/DataGenerator.hpp>
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
 #include <string>
@@ -52,8 +53,59 @@ void test1(std::string feats_filename, std::string labels_filename)
 
 }
 
+void test2(std::string filename)
+{
+	DataGenerator<HousingReader,HousingReader,UnitL2Normalizer> gen(filename, filename);
+	gen.set_num_examples(300);
+	gen.set_seed(12345);
+	gen.generate();
+
+	Matrix<float64_t> data(gen.get_regressors().rows(), gen.get_regressors().cols() + 1);
+	data << gen.get_regressors(), gen.get_regressand();
+	Matrix<float64_t> expected = data.transpose() * data;
+
+	// the blocked computation is the same for any number of threads
+	for (index_t num_threads = 1; num_threads <= 4; ++num_threads)
+	{
+		gen.set_num_threads(num_threads);
+		Matrix<float64_t> cov;
+		gen.get_cov(cov);
+
+		assert((cov - expected).norm() < 1E-10);
+		assert(cov == cov.transpose());
+		assert(cov == gen.get_cov());
+	}
+}
+
+void test3(std::string filename)
+{
+	DataGenerator<HousingReader,HousingReader,UnitL2Normalizer> gen(filename, filename);
+	gen.set_num_examples(300);
+	gen.set_seed(12345);
+	gen.generate();
+	Matrix<float64_t> expected = gen.get_cov();
+
+	// streaming the same examples gives the same covariance for any chunk size
+	std::vector<index_t> chunk_sizes = {1, 7, 300, 1000};
+	for (index_t i = 0; i < chunk_sizes.size(); ++i)
+	{
+		DataGenerator<HousingReader,HousingReader,UnitL2Normalizer> stream_gen(filename, filename);
+		stream_gen.set_num_examples(300);
+		stream_gen.set_seed(12345);
+		stream_gen.set_chunk_size(chunk_sizes[i]);
+
+		Matrix<float64_t> cov;
+		stream_gen.generate_cov(cov);
+
+		assert((cov - expected).norm() < 1E-10);
+		assert(cov == cov.transpose());
+	}
+}
+
 int main(int argc, char** argv)
 {
+	test2("data/housing.data");
+	test3("data/housing.data");
 	test1("data/train-images-idx3-ubyte", "data/train-labels-idx1-ubyte");
 	test1("data/t10k-images-idx3-ubyte", "data/t10k-labels-idx1-ubyte");
 	return 0;
@@ -23,7 +23,11 @@
  */
 
 #include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include "RandomCovariance.hpp"
 #include <cstdlib>
 #include <cmath>
 
@@ -99,8 +103,115 @@ void test1()
 		assert(octave[i] == inds[i]);
 }
 
+void test2()
+{
+	int dim = 50;
+	int N = 100;
+	int k = 10;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+	fr.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> serial = fr.run();
+
+	// results must be bit-identical regardless of the number of threads
+	for (index_t num_threads = 2; num_threads <= 7; ++num_threads)
+	{
+		params.num_threads = num_threads;
+		fr.set_params(params);
+		std::pair<float64_t,std::vector<index_t>> parallel = fr.run();
+
+		assert(serial.first == parallel.first);
+		assert(serial.second == parallel.second);
+	}
+}
+
+void test3()
+{
+	int dim = 50;
+	int N = 100;
+	int k = 10;
+	MatrixXd cov = random_cov(N, dim + 1);
+	MatrixXf cov_float = cov.cast<float32_t>();
+
+	// single precision selects the same features with nearly the same value
+	typedef ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	typedef ForwardRegression<SmoothedDifferentialEntropy, float32_t>::param_type param_type_float;
+
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+	fr.set_params(param_type(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5)));
+	auto result = fr.run();
+
+	ForwardRegression<SmoothedDifferentialEntropy, float32_t> fr_float(cov_float, k);
+	fr_float.set_params(param_type_float(0.1f, SmoothedDifferentialEntropyParam<float32_t>(0.5f)));
+	auto result_float = fr_float.run();
+
+	assert(result_float.second == result.second);
+	assert(std::abs(result_float.first - result.first) < 1e-4 * std::abs(result.first));
+
+	// and so does single precision storage with double precision solves
+	param_type_float params_mixed(0.1f, SmoothedDifferentialEntropyParam<float32_t>(0.5f));
+	params_mixed.mixed_precision = true;
+	fr_float.set_params(params_mixed);
+	auto result_mixed = fr_float.run();
+
+	assert(result_mixed.second == result.second);
+	assert(std::abs(result_mixed.first - result.first) < 1e-4 * std::abs(result.first));
+}
+
+void test4()
+{
+	int dim = 40;
+	int N = 100;
+	int k_max = 12;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov);
+	fr.set_params(params);
+	auto path = fr.run_path(k_max);
+	assert(path.size() == k_max);
+
+	// every entry of the path is what a run for that many features returns
+	for (index_t k = 1; k <= k_max; ++k)
+	{
+		ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr_k(cov, k);
+		fr_k.set_params(params);
+		auto result = fr_k.run();
+
+		assert(path[k-1].second == result.second);
+		assert(path[k-1].first == result.first);
+	}
+
+	// greedy local search warm-started from the path gives the same result
+	typedef GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t> gls_type;
+	typename gls_type::param_type gls_params(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	for (index_t k = 1; k <= k_max; k += 5)
+	{
+		gls_type gls(cov, k);
+		gls.set_params(gls_params);
+		auto result = gls.run();
+
+		gls_type gls_warm(cov, k);
+		gls_warm.set_params(gls_params);
+		gls_warm.set_fr_result(path[k-1]);
+		auto result_warm = gls_warm.run();
+
+		assert(result_warm.second == result.second);
+		assert(result_warm.first == result.first);
+	}
+}
+
 int main(int argc, char** argv)
 {
 	test1();
+	test2();
+	test3();
+	test4();
 	return 0;
 }
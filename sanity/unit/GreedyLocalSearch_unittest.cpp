@@ -0,0 +1,76 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LocalSearch.hpp>
+#include <tesseract/algorithm/LinearLocalSearch.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+template <template<template<class>class,typename> class LSAlgo>
+void test1()
+{
+	int dim = 40;
+	int N = 100;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef GreedyLocalSearch<ForwardRegression,LSAlgo,SmoothedDifferentialEntropy,float64_t> gls_type;
+	typename gls_type::param_type params(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	for (index_t k = 1; k <= 10; ++k)
+	{
+		ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+		fr.set_params(params.fr_params);
+		float64_t g_fr = fr.run().first;
+
+		// LS and the 2nd phase of FR one after the other
+		params.num_threads = 1;
+		gls_type gls(cov, k);
+		gls.set_params(params);
+		std::pair<float64_t,std::vector<index_t>> serial = gls.run();
+
+		// LS and the 2nd phase of FR concurrently
+		params.num_threads = 2;
+		gls_type gls_par(cov, k);
+		gls_par.set_params(params);
+		std::pair<float64_t,std::vector<index_t>> parallel = gls_par.run();
+
+		assert(serial.first >= g_fr);
+		assert(serial.first == parallel.first);
+		assert(serial.second == parallel.second);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	test1<LocalSearch>();
+	test1<LinearLocalSearch>();
+	return 0;
+}
@@ -24,6 +24,10 @@
 
 #include <tesseract/io/IDX1Reader.hpp>
 #include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <fstream>
+#include <unistd.h>
 
 using namespace tesseract;
 
@@ -38,8 +42,38 @@ void test1(std::string filename)
 //	printf("\n");
 }
 
+void test2()
+{
+	// write a small IDX1 file with 6 labels
+	char filename[] = "/tmp/idx1XXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	close(fd);
+
+	ubyte_t header[8] = {0, 0, 8, 1, 0, 0, 0, 6};
+	std::ofstream os(filename, std::ios::out | std::ios::binary);
+	os.write(reinterpret_cast<char*>(header), 8);
+	for (ubyte_t c = 0; c < 6; ++c)
+		os.put(static_cast<char>(10 + c));
+	os.close();
+
+	IDX1Reader reader(filename);
+	reader.load_header();
+	assert(reader.get_num_labels() == 6);
+
+	// only the sampled records are read, duplicates included
+	std::vector<int32_t> indices = {0, 2, 2, 5};
+	reader.load(indices);
+
+	for (index_t k = 0; k < indices.size(); ++k)
+		assert(reader.get_label(k) == 10 + indices[k]);
+
+	std::remove(filename);
+}
+
 int main(int argc, char** argv)
 {
+	test2();
 	test1("data/train-labels-idx1-ubyte");
 	test1("data/t10k-labels-idx1-ubyte");
 	return 0;
@@ -28,6 +28,8 @@
 #include <cstdlib>
 #include <cstdio>
 #include <ctime>
+#include <fstream>
+#include <unistd.h>
 
 using namespace tesseract;
 
@@ -68,8 +70,84 @@ void test2(std::string filename)
 	std::cout << count << std::endl;
 }
 */
+void test3(bool use_mmap)
+{
+	// write a small IDX3 file with 3 images of 2x2 pixels
+	char filename[] = "/tmp/idx3XXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	close(fd);
+
+	ubyte_t header[16] = {0, 0, 8, 3, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 2};
+	std::ofstream os(filename, std::ios::out | std::ios::binary);
+	os.write(reinterpret_cast<char*>(header), 16);
+	for (ubyte_t c = 0; c < 12; ++c)
+		os.put(static_cast<char>(c));
+	os.close();
+
+	IDX3Reader::Image image;
+	{
+		IDX3Reader reader(filename, use_mmap);
+		reader.load();
+
+		assert(reader.get_num_images() == 3);
+		assert(reader.get_num_rows() == 2);
+		assert(reader.get_num_cols() == 2);
+
+		image = reader.get_image(1);
+	}
+
+	// the image stays valid after the reader is gone
+	assert(image.size() == 4);
+	for (index_t j = 0; j < image.size(); ++j)
+		assert(image[j] == 4 + j);
+
+	std::remove(filename);
+}
+
+void test4(bool use_mmap)
+{
+	// write a small IDX3 file with 5 images of 1x3 pixels
+	char filename[] = "/tmp/idx3XXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	close(fd);
+
+	ubyte_t header[16] = {0, 0, 8, 3, 0, 0, 0, 5, 0, 0, 0, 1, 0, 0, 0, 3};
+	std::ofstream os(filename, std::ios::out | std::ios::binary);
+	os.write(reinterpret_cast<char*>(header), 16);
+	for (ubyte_t c = 0; c < 15; ++c)
+		os.put(static_cast<char>(c));
+	os.close();
+
+	IDX3Reader reader(filename, use_mmap);
+	reader.load_header();
+	assert(reader.get_num_images() == 5);
+	assert(reader.get_num_rows() == 1);
+	assert(reader.get_num_cols() == 3);
+
+	// only the sampled records are read, duplicates included
+	std::vector<int32_t> indices = {1, 3, 3, 4};
+	reader.load(indices);
+	assert(reader.get_num_images() == 5);
+
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		IDX3Reader::Image& image = reader.get_image(k);
+		assert(image.size() == 3);
+		for (index_t j = 0; j < image.size(); ++j)
+			assert(image[j] == 3 * indices[k] + j);
+	}
+
+	std::remove(filename);
+}
+
 int main(int argc, char** argv)
 {
+	test3(true);
+	test3(false);
+	test4(true);
+	test4(false);
 	test1("data/train-images-idx3-ubyte");
 	test1("data/t10k-images-idx3-ubyte");
 //	test2("data/train-images-idx3-ubyte");
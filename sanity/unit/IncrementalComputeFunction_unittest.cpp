@@ -0,0 +1,242 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/computation/IncrementalCholesky.hpp>
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <tesseract/features/Features.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	int dim = 6;
+	int n = 20;
+	MatrixXd m = MatrixXd::Random(n, dim);
+	MatrixXd cov = m.transpose() * m;
+
+	// grow the factor one feature at a time and compare with the full factor
+	IncrementalCholesky<float64_t> chol(2);
+	for (index_t k = 0; k < dim; ++k)
+	{
+		VectorXd l = cov.col(k).head(k + 1);
+		float64_t d_sq = chol.pivot(l, cov(k, k));
+		chol.extend(l, d_sq);
+
+		MatrixXd L = cov.topLeftCorner(k + 1, k + 1).llt().matrixL();
+		assert((chol.get_factor().triangularView<Lower>().toDenseMatrix() - L).norm() < 1E-10);
+		assert(std::abs(chol.log_det() - log(cov.topLeftCorner(k + 1, k + 1).determinant())) < 1E-10);
+	}
+}
+
+template <template <class> class Regularizer>
+void test2(typename Regularizer<float64_t>::param_type reg_params)
+{
+	int dim = 8;
+	int n = 30;
+	MatrixXd cov = random_cov(n, dim + 1);
+
+	float64_t eta = 0.1;
+
+	ComputeFunction<Regularizer, float64_t> g;
+	g.set_eta(eta);
+	g.set_reg_params(reg_params);
+
+	IncrementalComputeFunction<Regularizer, float64_t> inc_g(cov, 2);
+	inc_g.set_eta(eta);
+	inc_g.set_reg_params(reg_params);
+	typename IncrementalComputeFunction<Regularizer, float64_t>::Workspace work;
+
+	// add the features in a fixed order, evaluate every candidate on the way
+	std::vector<index_t> order = {5, 2, 7, 0, 3};
+	for (index_t i = 0; i < order.size(); ++i)
+	{
+		for (index_t j = 0; j < dim; ++j)
+		{
+			std::vector<index_t> inds(inc_g.get_inds());
+			if (std::find(inds.begin(), inds.end(), j) != inds.end())
+				continue;
+
+			inds.push_back(j);
+			inds.push_back(dim);
+			float64_t expected = g(Features<float64_t>::copy_cov(cov, inds));
+			assert(std::abs(inc_g(j, work) - expected) < 1E-10);
+		}
+
+		inc_g.add(order[i]);
+		assert(inc_g.get_inds().size() == i + 1);
+	}
+}
+
+template <template <class> class Regularizer>
+void test3(typename Regularizer<float64_t>::param_type reg_params)
+{
+	int dim = 8;
+	int n = 30;
+	MatrixXd cov = random_cov(n, dim + 1);
+
+	float64_t eta = 0.1;
+
+	ComputeFunction<Regularizer, float64_t> g;
+	g.set_eta(eta);
+	g.set_reg_params(reg_params);
+
+	IncrementalComputeFunction<Regularizer, float64_t> inc_g(cov, 2);
+	inc_g.set_eta(eta);
+	inc_g.set_reg_params(reg_params);
+	typename IncrementalComputeFunction<Regularizer, float64_t>::Workspace work;
+
+	std::vector<index_t> order = {5, 2, 7, 0, 3};
+	for (index_t i = 0; i < order.size(); ++i)
+		inc_g.add(order[i]);
+
+	// swap features in and out and evaluate every candidate on the way
+	std::vector<index_t> removals = {1, 3, 0};
+	std::vector<index_t> additions = {6, 2, 1};
+	for (index_t r = 0; r < removals.size(); ++r)
+	{
+		inc_g.remove(removals[r]);
+
+		std::vector<index_t> cur_inds(inc_g.get_inds());
+		cur_inds.push_back(dim);
+		assert(std::abs(inc_g.get_value() - g(Features<float64_t>::copy_cov(cov, cur_inds))) < 1E-10);
+
+		for (index_t j = 0; j < dim; ++j)
+		{
+			std::vector<index_t> inds(inc_g.get_inds());
+			if (std::find(inds.begin(), inds.end(), j) != inds.end())
+				continue;
+
+			inds.push_back(j);
+			inds.push_back(dim);
+			float64_t expected = g(Features<float64_t>::copy_cov(cov, inds));
+			assert(std::abs(inc_g(j, work) - expected) < 1E-10);
+		}
+
+		inc_g.add(additions[r]);
+	}
+}
+
+template <template <class> class Regularizer>
+void test4(typename Regularizer<float64_t>::param_type reg_params)
+{
+	int dim = 12;
+	int n = 30;
+	MatrixXd cov = random_cov(n, dim + 1);
+
+	IncrementalComputeFunction<Regularizer, float64_t> inc_g(cov, 2);
+	inc_g.set_eta(0.1);
+	inc_g.set_reg_params(reg_params);
+	typename IncrementalComputeFunction<Regularizer, float64_t>::Workspace work;
+
+	// score all the candidates as a batch and compare with one at a time,
+	// starting from the empty set
+	std::vector<index_t> order = {5, 2, 7, 0, 3};
+	for (index_t i = 0; i <= order.size(); ++i)
+	{
+		std::vector<index_t> candidates;
+		for (index_t j = 0; j < dim; ++j)
+		{
+			const std::vector<index_t>& inds = inc_g.get_inds();
+			if (std::find(inds.begin(), inds.end(), j) == inds.end())
+				candidates.push_back(j);
+		}
+
+		VectorXd values(candidates.size());
+		inc_g.score_extensions(candidates, values, work);
+		for (index_t c = 0; c < candidates.size(); ++c)
+		{
+			assert(std::abs(values[c] - inc_g(candidates[c], work)) < 1E-10);
+		}
+
+		if (i < order.size())
+			inc_g.add(order[i]);
+	}
+}
+
+template <template <class> class Regularizer>
+void test5(typename Regularizer<float32_t>::param_type reg_params,
+		typename Regularizer<float64_t>::param_type reg_params_double)
+{
+	int dim = 12;
+	int n = 30;
+	// single precision storage, the reference is evaluated in double precision
+	// on the same (rounded) entries
+	MatrixXf cov = random_cov(n, dim + 1).cast<float32_t>();
+	MatrixXd cov_double = cov.cast<float64_t>();
+
+	ComputeFunction<Regularizer, float64_t> g;
+	g.set_eta(0.1);
+	g.set_reg_params(reg_params_double);
+
+	ComputeFunction<Regularizer, float32_t, float64_t> mixed_g;
+	mixed_g.set_eta(0.1f);
+	mixed_g.set_reg_params(reg_params);
+
+	IncrementalComputeFunction<Regularizer, float32_t, float64_t> inc_g(cov, 2);
+	inc_g.set_eta(0.1f);
+	inc_g.set_reg_params(reg_params);
+	typename IncrementalComputeFunction<Regularizer, float32_t, float64_t>::Workspace work;
+
+	std::vector<index_t> order = {5, 2, 7, 0, 3};
+	for (index_t i = 0; i < order.size(); ++i)
+	{
+		std::vector<index_t> inds(inc_g.get_inds());
+		inds.push_back(order[i]);
+		inds.push_back(dim);
+
+		float64_t expected = g(Features<float64_t>::copy_cov(cov_double, inds));
+		assert(std::abs(inc_g(order[i], work) - expected) < 1E-5 * std::abs(expected));
+		assert(std::abs(mixed_g(Features<float32_t>::copy_cov(cov, inds)) - expected) < 1E-5 * std::abs(expected));
+
+		inc_g.add(order[i]);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2<DummyRegularizer>(DummyRegularizerParam());
+	test2<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test2<SpectralVariance>(SpectralVarianceParam<float64_t>());
+	test3<DummyRegularizer>(DummyRegularizerParam());
+	test3<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test3<SpectralVariance>(SpectralVarianceParam<float64_t>());
+	test4<DummyRegularizer>(DummyRegularizerParam());
+	test4<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test4<SpectralVariance>(SpectralVarianceParam<float64_t>());
+	test5<DummyRegularizer>(DummyRegularizerParam(), DummyRegularizerParam());
+	test5<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float32_t>(0.5f),
+			SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test5<SpectralVariance>(SpectralVarianceParam<float32_t>(), SpectralVarianceParam<float64_t>());
+	return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/regularizer/IncrementalRegularizer.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <tesseract/features/Features.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	int dim = 7;
+	int n = 25;
+	MatrixXd m = MatrixXd::Random(n, dim);
+	MatrixXd cov = m.transpose() * m;
+
+	float64_t delta = 0.5;
+	SmoothedDifferentialEntropy<float64_t> f;
+	f.set_params(SmoothedDifferentialEntropyParam<float64_t>(delta));
+
+	// the Cholesky based evaluation agrees with the eigen values
+	for (index_t k = 1; k <= dim; ++k)
+	{
+		VectorXd eigenvalues = cov.topLeftCorner(k, k).eigenvalues().real();
+		float64_t expected = 0;
+		for (index_t i = 0; i < k; ++i)
+			expected += log2(delta + eigenvalues[i]);
+		expected -= 3 * k * log2(delta);
+
+		assert(std::abs(f(cov.topLeftCorner(k, k)) - expected) < 1E-10);
+	}
+}
+
+template <template <class> class Regularizer>
+void test2(typename Regularizer<float64_t>::param_type reg_params)
+{
+	int dim = 8;
+	int n = 30;
+	MatrixXd cov = random_cov(n, dim);
+
+	Regularizer<float64_t> f;
+	f.set_params(reg_params);
+
+	IncrementalRegularizer<Regularizer, float64_t> inc_f(2);
+	inc_f.set_params(reg_params);
+
+	// add the features in a fixed order, evaluate every candidate on the way
+	std::vector<index_t> order = {4, 1, 6, 0, 3};
+	std::vector<index_t> inds;
+	VectorXd cross(dim);
+	for (index_t i = 0; i < order.size(); ++i)
+	{
+		for (index_t j = 0; j < dim; ++j)
+		{
+			if (std::find(inds.begin(), inds.end(), j) != inds.end())
+				continue;
+
+			for (index_t r = 0; r < inds.size(); ++r)
+				cross[r] = cov(inds[r], j);
+
+			std::vector<index_t> cur_inds(inds);
+			cur_inds.push_back(j);
+			float64_t expected = f(Features<float64_t>::copy_cov(cov, cur_inds));
+			assert(std::abs(inc_f.extension(cross, cov(j, j)) - expected) < 1E-10);
+		}
+
+		for (index_t r = 0; r < inds.size(); ++r)
+			cross[r] = cov(inds[r], order[i]);
+		inc_f.add(cross, cov(order[i], order[i]));
+		inds.push_back(order[i]);
+
+		// copy_cov sorts the indices, inds has to stay in the order of addition
+		std::vector<index_t> sorted_inds(inds);
+		assert(inc_f.size() == i + 1);
+		assert(std::abs(inc_f.value() - f(Features<float64_t>::copy_cov(cov, sorted_inds))) < 1E-10);
+	}
+
+	inc_f.clear();
+	assert(inc_f.size() == 0);
+}
+
+template <template <class> class Regularizer>
+void test3(typename Regularizer<float64_t>::param_type reg_params)
+{
+	int dim = 8;
+	int n = 30;
+	MatrixXd cov = random_cov(n, dim);
+
+	Regularizer<float64_t> f;
+	f.set_params(reg_params);
+
+	IncrementalRegularizer<Regularizer, float64_t> inc_f(2);
+	inc_f.set_params(reg_params);
+
+	std::vector<index_t> inds = {4, 1, 6, 0, 3, 7};
+	VectorXd cross(dim);
+	for (index_t i = 0; i < inds.size(); ++i)
+	{
+		for (index_t r = 0; r < i; ++r)
+			cross[r] = cov(inds[r], inds[i]);
+		inc_f.add(cross, cov(inds[i], inds[i]));
+	}
+
+	// remove from the middle, the front and the back, adding one in between
+	std::vector<index_t> positions = {2, 0, 3};
+	for (index_t p : positions)
+	{
+		// every removal is evaluated on the way
+		for (index_t q = 0; q < inds.size(); ++q)
+		{
+			for (index_t r = 0; r < inds.size(); ++r)
+				cross[r] = cov(inds[r], inds[q]);
+
+			std::vector<index_t> cur_inds(inds);
+			cur_inds.erase(cur_inds.begin() + q);
+			float64_t expected = f(Features<float64_t>::copy_cov(cov, cur_inds));
+			assert(std::abs(inc_f.removal(q, cross.head(inds.size())) - expected) < 1E-10);
+		}
+
+		for (index_t r = 0; r < inds.size(); ++r)
+			cross[r] = cov(inds[r], inds[p]);
+		inc_f.remove(p, cross.head(inds.size()));
+		inds.erase(inds.begin() + p);
+
+		std::vector<index_t> sorted_inds(inds);
+		assert(inc_f.size() == inds.size());
+		assert(std::abs(inc_f.value() - f(Features<float64_t>::copy_cov(cov, sorted_inds))) < 1E-10);
+
+		// extensions use the new order
+		index_t j = (p == 0) ? 2 : 5;
+		for (index_t r = 0; r < inds.size(); ++r)
+			cross[r] = cov(inds[r], j);
+		inc_f.add(cross, cov(j, j));
+		inds.push_back(j);
+
+		sorted_inds = inds;
+		assert(std::abs(inc_f.value() - f(Features<float64_t>::copy_cov(cov, sorted_inds))) < 1E-10);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2<DummyRegularizer>(DummyRegularizerParam());
+	test2<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test2<SpectralVariance>(SpectralVarianceParam<float64_t>());
+	test3<DummyRegularizer>(DummyRegularizerParam());
+	test3<SmoothedDifferentialEntropy>(SmoothedDifferentialEntropyParam<float64_t>(0.5));
+	test3<SpectralVariance>(SpectralVarianceParam<float64_t>());
+	return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/features/IndexedCovariance.hpp>
+#include <tesseract/features/Features.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	index_t dim = 10;
+	int n = 20;
+	MatrixXd m = MatrixXd::Random(n, dim + 1);
+	MatrixXd cov = m.transpose() * m;
+
+	std::vector<index_t> inds = {7, 2, 4, dim};
+	IndexedCovariance<float64_t> view(cov, inds);
+	assert(view.rows() == inds.size() && view.cols() == inds.size());
+
+	// the view doesn't sort the indices, copy_cov does
+	for (index_t i = 0; i < inds.size(); ++i)
+		for (index_t j = 0; j < inds.size(); ++j)
+			assert(view(i, j) == cov(inds[i], inds[j]));
+
+	// gathering into a larger workspace doesn't reallocate
+	MatrixXd workspace(dim, dim);
+	const float64_t* data = workspace.data();
+	MatrixXd c_s = view.gather(workspace);
+	assert(workspace.data() == data);
+
+	std::vector<index_t> sorted_inds(inds);
+	MatrixXd copied = Features<float64_t>::copy_cov(cov, sorted_inds);
+	assert(copied.rows() == c_s.rows());
+
+	// the objective doesn't depend on the order as long as b is the last one
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	assert(std::abs(g(view) - g(copied)) < 1E-10);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	return 0;
+}
@@ -25,6 +25,7 @@
 #include <iostream>
 #include <tesseract/regression/LeastSquares.hpp>
 #include <Eigen/Eigen>
+#include <vector>
 
 using namespace tesseract;
 using namespace Eigen;
@@ -57,6 +58,32 @@ void test_normal(Matrix& A, Vector& b, Vector& x)
 //	cout << "residual = " << b-A*x << endl;
 }
 
+void test_gram()
+{
+	MatrixXd A = MatrixXd::Random(50, 8);
+	VectorXd b = VectorXd::Random(50);
+
+	// Gram matrix of [A b]
+	MatrixXd Ab(A.rows(), A.cols() + 1);
+	Ab << A, b;
+	MatrixXd G = Ab.transpose() * Ab;
+
+	// solving for a subset from the Gram matrix is the same as on its columns
+	std::vector<index_t> inds = {5, 1, 6};
+	MatrixXd A_S(A.rows(), inds.size());
+	for (index_t j = 0; j < inds.size(); ++j)
+		A_S.col(j) = A.col(inds[j]);
+
+	VectorXd x = VectorXd::Zero(inds.size());
+	LeastSquares<double, LS_GRAM> ls;
+	ls.solve(G, inds, x);
+
+	VectorXd x_normal = VectorXd::Zero(inds.size());
+	test_normal(A_S, b, x_normal);
+
+	assert((x - x_normal).norm() < 1e-10);
+}
+
 int main(int argc, char** argv)
 {
 	MatrixXd A = MatrixXd::Random(3, 2);
@@ -78,5 +105,7 @@ int main(int argc, char** argv)
 	test_qr(map_A, map_b, map_res);
 	test_normal(map_A, map_b, map_res);
 
+	test_gram();
+
 	return 0;
 }
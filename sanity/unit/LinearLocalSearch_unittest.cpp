@@ -0,0 +1,181 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/algorithm/LinearLocalSearch.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+
+using namespace tesseract;
+using namespace Eigen;
+
+MatrixXd gather(const MatrixXd& cov, const std::vector<index_t>& inds)
+{
+	MatrixXd c_S(inds.size(), inds.size());
+	for (index_t j = 0; j < inds.size(); ++j)
+		for (index_t i = 0; i < inds.size(); ++i)
+			c_S(i, j) = cov(inds[i], inds[j]);
+	return c_S;
+}
+
+// the sets X and Y of the linear local search with the regularizer evaluated
+// from scratch at every step
+std::vector<index_t> reference(const MatrixXd& cov, float64_t delta)
+{
+	index_t n = cov.cols() - 1;
+	SmoothedDifferentialEntropy<float64_t> f;
+	f.set_params(SmoothedDifferentialEntropyParam<float64_t>(delta));
+
+	float64_t f_Xi = 0;
+	float64_t f_Yi = f(cov.topLeftCorner(n, n));
+
+	std::vector<index_t> X;
+	std::vector<bool> removed(n, false);
+
+	for (index_t i = 0; i < n; ++i)
+	{
+		std::vector<index_t> X_i(X);
+		X_i.push_back(i);
+		float64_t current_fX = f(gather(cov, X_i));
+
+		std::vector<index_t> Y_i;
+		for (index_t j = 0; j < n; ++j)
+			if (!removed[j] && j != i)
+				Y_i.push_back(j);
+		float64_t current_fY = f(gather(cov, Y_i));
+
+		float64_t a_i = current_fX - f_Xi;
+		float64_t b_i = current_fY - f_Yi;
+		if (a_i >= b_i && a_i > 0.0)
+			X.push_back(i);
+		else
+			removed[i] = true;
+
+		f_Xi = current_fX;
+		f_Yi = current_fY;
+	}
+
+	return X;
+}
+
+// runs the linear local search and checks that it returns the best of the
+// reference set S, U \ S and U, with the objective evaluated from scratch
+std::vector<index_t> run_and_check(const MatrixXd& cov, float64_t delta, float64_t eta,
+		const std::vector<index_t>& expected)
+{
+	index_t dim = cov.cols() - 1;
+
+	typedef LinearLocalSearch<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	LinearLocalSearch<SmoothedDifferentialEntropy, float64_t> lls(cov);
+	lls.set_params(param_type(eta, SmoothedDifferentialEntropyParam<float64_t>(delta)));
+	std::pair<float64_t,std::vector<index_t>> result = lls.run();
+
+	std::vector<index_t> S(expected);
+	std::vector<index_t> rest;
+	for (index_t i = 0, r = 0; i < dim; ++i)
+	{
+		if (r < expected.size() && expected[r] == i)
+			++r;
+		else
+			rest.push_back(i);
+	}
+
+	std::vector<index_t> all(dim);
+	for (index_t i = 0; i < dim; ++i)
+		all[i] = i;
+
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	g.set_eta(eta);
+	g.set_reg_params(SmoothedDifferentialEntropyParam<float64_t>(delta));
+
+	// the last row/col holds b_S
+	std::vector<std::vector<index_t>> sets = {S, rest, all};
+	index_t best = 0;
+	std::vector<float64_t> values(sets.size());
+	for (index_t k = 0; k < sets.size(); ++k)
+	{
+		std::vector<index_t> inds(sets[k]);
+		inds.push_back(dim);
+		values[k] = g(IndexedCovariance<float64_t>(cov, inds));
+		if (values[k] > values[best])
+			best = k;
+	}
+
+	assert(std::abs(result.first - values[best]) < 1e-8);
+	assert(result.second == sets[best]);
+
+	return result.second;
+}
+
+MatrixXd latent_cov(index_t N, index_t dim)
+{
+	std::srand(1);
+
+	// the features are noisy combinations of a few latent ones, so that some of
+	// them are strongly correlated with the rest
+	MatrixXd m = MatrixXd::Random(N, 4) * MatrixXd::Random(4, dim + 1) + 0.2 * MatrixXd::Random(N, dim + 1);
+	for (index_t i = 0; i < m.cols(); ++i)
+		m.col(i).normalize();
+	return m.transpose() * m;
+}
+
+void test1()
+{
+	index_t dim = 20;
+	MatrixXd cov = latent_cov(25, dim);
+
+	// with delta > 1 the features are both added and removed, so that the
+	// factorizations of X and Y are updated in an interleaved fashion
+	float64_t delta = 1.1;
+	std::vector<index_t> expected = reference(cov, delta);
+	assert(expected.size() > 0 && expected.size() < dim);
+
+	// with a strong regularizer the incremental X and Y end up as S, which wins
+	std::vector<index_t> inds = run_and_check(cov, delta, 2.0, expected);
+	assert(inds == expected);
+}
+
+void test2()
+{
+	index_t dim = 20;
+	MatrixXd cov = latent_cov(25, dim);
+
+	float64_t delta = 1.1;
+	std::vector<index_t> expected = reference(cov, delta);
+
+	// with a weak regularizer the fit dominates, so that U wins over S
+	std::vector<index_t> inds = run_and_check(cov, delta, 0.1, expected);
+	assert(inds.size() == dim);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	return 0;
+}
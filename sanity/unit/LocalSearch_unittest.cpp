@@ -24,6 +24,7 @@
 
 #include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include "RandomCovariance.hpp"
 #include <cstdlib>
 #include <cmath>
 #include <iostream>
@@ -63,8 +64,66 @@ void test1()
 	assert(inds.size() == dim);
 }
 
+void test2()
+{
+	int dim = 40;
+	int N = 100;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef LocalSearch<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, 0.5, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	LocalSearch<SmoothedDifferentialEntropy, float64_t> ls(cov);
+	ls.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> serial = ls.run();
+
+	// results must be bit-identical regardless of the number of threads
+	for (index_t num_threads = 2; num_threads <= 7; ++num_threads)
+	{
+		params.num_threads = num_threads;
+		ls.set_params(params);
+		std::pair<float64_t,std::vector<index_t>> parallel = ls.run();
+
+		assert(serial.first == parallel.first);
+		assert(serial.second == parallel.second);
+	}
+}
+
+void test3()
+{
+	int dim = 30;
+	int N = 8;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	// with delta > 1 adding a correlated feature decreases the regularizer, so
+	// that removals and exchanges pay off
+	typedef LocalSearch<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, 0.5, SmoothedDifferentialEntropyParam<float64_t>(1.2));
+
+	LocalSearch<SmoothedDifferentialEntropy, float64_t> ls(cov);
+	ls.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> add_only = ls.run();
+
+	params.delete_moves = true;
+	params.swap_moves = true;
+	ls.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> result = ls.run();
+
+	assert(result.second.size() < add_only.second.size());
+
+	assert(std::isfinite(result.first));
+	assert(result.second.size() > 0 && result.second.size() <= dim);
+	for (index_t i = 0; i < result.second.size(); ++i)
+	{
+		assert(result.second[i] < dim);
+		assert(i == 0 || result.second[i - 1] < result.second[i]);
+	}
+}
+
 int main(int argc, char** argv)
 {
 	test1();
+	test2();
+	test3();
 	return 0;
 }
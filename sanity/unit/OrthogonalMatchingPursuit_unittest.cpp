@@ -0,0 +1,106 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/algorithm/OrthogonalMatchingPursuit.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/features/Features.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	int dim = 30;
+	int N = 80;
+	int k = 8;
+	MatrixXd m = random_data(N, dim + 1);
+	MatrixXd cov = m.transpose() * m;
+
+	MatrixXd X = m.leftCols(dim);
+	VectorXd y = m.col(dim);
+
+	// omp on the data matrix, the residual is recomputed by least squares
+	std::vector<index_t> expected;
+	VectorXd r = y;
+	for (index_t i = 0; i < k; ++i)
+	{
+		VectorXd corr = (X.transpose() * r).cwiseAbs();
+		for (index_t j = 0; j < expected.size(); ++j)
+			corr[expected[j]] = 0;
+
+		index_t argmax;
+		corr.maxCoeff(&argmax);
+		expected.push_back(argmax);
+
+		MatrixXd X_S(N, expected.size());
+		for (index_t j = 0; j < expected.size(); ++j)
+			X_S.col(j) = X.col(expected[j]);
+		r = y - X_S * X_S.colPivHouseholderQr().solve(y);
+	}
+
+	OrthogonalMatchingPursuit<DummyRegularizer, float64_t> omp(cov, k);
+	std::pair<float64_t,std::vector<index_t>> result = omp.run();
+	assert(expected == result.second);
+
+	// the returned value is R^2 of the selection
+	assert(std::abs(result.first - (1 - r.squaredNorm())) < 1E-10);
+}
+
+void test2()
+{
+	int dim = 30;
+	int N = 80;
+	int k = 5;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef OrthogonalMatchingPursuit<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	OrthogonalMatchingPursuit<SmoothedDifferentialEntropy, float64_t> omp(cov, k);
+	omp.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> result = omp.run();
+
+	// the returned value is g of the selection
+	std::vector<index_t> inds = result.second;
+	assert(inds.size() == k);
+	inds.push_back(dim);
+
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+	assert(std::abs(g(Features<float64_t>::copy_cov(cov, inds)) - result.first) < 1E-10);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RANDOM_COVARIANCE_H__
+#define RANDOM_COVARIANCE_H__
+
+#include <tesseract/base/types.h>
+
+/** @return random data of num_examples rows and num_cols columns, each
+ * column unit L2 normalized as by the DataGenerator
+ */
+inline Eigen::MatrixXd random_data(tesseract::index_t num_examples, tesseract::index_t num_cols)
+{
+	Eigen::MatrixXd m = Eigen::MatrixXd::Random(num_examples, num_cols);
+	for (tesseract::index_t i = 0; i < m.cols(); ++i)
+		m.col(i).normalize();
+	return m;
+}
+
+/** @return the covariance matrix of random_data(num_examples, num_cols), for
+ * the algorithms the last column is the regressand
+ */
+inline Eigen::MatrixXd random_cov(tesseract::index_t num_examples, tesseract::index_t num_cols)
+{
+	Eigen::MatrixXd m = random_data(num_examples, num_cols);
+	return m.transpose() * m;
+}
+
+#endif // RANDOM_COVARIANCE_H__
@@ -0,0 +1,101 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/evaluation/ResultWriter.hpp>
+#include <sstream>
+#include <string>
+
+using namespace tesseract;
+
+GridResult get_result(int32_t seed, std::string params)
+{
+	GridResult result;
+	result.seed = seed;
+	result.num_examples = 100;
+	result.params = params;
+	result.target_feats = 5;
+	result.num_feats = 4;
+	result.value = 0.5;
+	result.train_time = 0.25;
+	result.sum_squared_error = 1.5;
+	result.pearsons_correlation = 0.75;
+	result.squared_multiple_correlation = 0.125;
+	return result;
+}
+
+void test1()
+{
+	std::ostringstream out;
+	{
+		ResultWriter writer(out, CSV);
+		writer.write(get_result(1, "eta=0.1"));
+		writer.write(get_result(2, "eta=0.1, eps=1"));
+	}
+
+	// header once, fields with separators are quoted
+	assert(out.str() ==
+			"seed,num_examples,params,target_feats,num_feats,value,train_time,"
+			"sum_squared_error,pearsons_correlation,squared_multiple_correlation\n"
+			"1,100,eta=0.1,5,4,0.5,0.25,1.5,0.75,0.125\n"
+			"2,100,\"eta=0.1, eps=1\",5,4,0.5,0.25,1.5,0.75,0.125\n");
+}
+
+void test2()
+{
+	std::ostringstream out;
+	ResultWriter writer(out, JSON);
+	writer.write(get_result(1, "a \"b\""));
+	writer.write(get_result(2, "c"));
+	writer.close();
+
+	assert(out.str() ==
+			"[\n"
+			"{\"seed\": 1, \"num_examples\": 100, \"params\": \"a \\\"b\\\"\", \"target_feats\": 5, "
+			"\"num_feats\": 4, \"value\": 0.5, \"train_time\": 0.25, \"sum_squared_error\": 1.5, "
+			"\"pearsons_correlation\": 0.75, \"squared_multiple_correlation\": 0.125},\n"
+			"{\"seed\": 2, \"num_examples\": 100, \"params\": \"c\", \"target_feats\": 5, "
+			"\"num_feats\": 4, \"value\": 0.5, \"train_time\": 0.25, \"sum_squared_error\": 1.5, "
+			"\"pearsons_correlation\": 0.75, \"squared_multiple_correlation\": 0.125}\n"
+			"]\n");
+
+	// control characters are escaped
+	std::ostringstream control;
+	ResultWriter control_writer(control, JSON);
+	control_writer.write(get_result(3, "a\tb\r\n\x01\\"));
+	control_writer.close();
+	assert(control.str().find("\"params\": \"a\\tb\\r\\n\\u0001\\\\\"") != std::string::npos);
+
+	// an empty grid is still valid JSON
+	std::ostringstream empty;
+	ResultWriter empty_writer(empty, JSON);
+	empty_writer.close();
+	assert(empty.str() == "[]\n");
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	return 0;
+}
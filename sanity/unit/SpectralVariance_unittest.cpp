@@ -23,6 +23,7 @@
  */
 
 #include <tesseract/regularizer/SpectralVariance.hpp>
+#include "RandomCovariance.hpp"
 #include <cstdlib>
 #include <iostream>
 #include <cmath>
@@ -50,8 +51,27 @@ void test1()
 	assert(abs(val - 76.110) < 1E-6);
 }
 
+void test2()
+{
+	int dim = 10;
+	int n = 40;
+	MatrixXd cov = random_cov(n, dim);
+
+	SpectralVariance<float64_t> f;
+	f.set_params(SpectralVariance<float64_t>::param_type());
+
+	// the trace identity agrees with the eigen values on every leading block
+	for (index_t k = 0; k <= dim; ++k)
+	{
+		MatrixXd c = cov.topLeftCorner(k, k);
+		float64_t expected = k > 0 ? f.eigen_value(c) : 0;
+		assert(std::abs(f(c) - expected) < 1E-10);
+	}
+}
+
 int main(int argc, char** argv)
 {
 	test1();
+	test2();
 	return 0;
 }
@@ -0,0 +1,98 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/algorithm/StochasticForwardRegression.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/features/Features.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	int dim = 50;
+	int N = 100;
+	int k = 10;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	SmoothedDifferentialEntropyParam<float64_t> reg_params(0.5);
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+	fr.set_params(ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type(0.1, reg_params));
+	std::pair<float64_t,std::vector<index_t>> expected = fr.run();
+
+	// with a pool as large as the rest of the features it is forward regression
+	typedef StochasticForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	StochasticForwardRegression<SmoothedDifferentialEntropy, float64_t> sfr(cov, k);
+	sfr.set_params(param_type(0.1, 1E-10, reg_params));
+	std::pair<float64_t,std::vector<index_t>> result = sfr.run();
+
+	assert(expected.first == result.first);
+	assert(expected.second == result.second);
+}
+
+void test2()
+{
+	int dim = 60;
+	int N = 100;
+	int k = 6;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	typedef StochasticForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(0.1, 0.5, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	StochasticForwardRegression<SmoothedDifferentialEntropy, float64_t> sfr(cov, k);
+	sfr.set_params(params);
+	sfr.set_seed(12345);
+	std::pair<float64_t,std::vector<index_t>> result = sfr.run();
+
+	// same seed gives the same result
+	std::pair<float64_t,std::vector<index_t>> again = sfr.run();
+	assert(result.first == again.first);
+	assert(result.second == again.second);
+
+	// returned value is g of the selected features
+	std::vector<index_t> inds = result.second;
+	assert(inds.size() == k);
+	std::sort(inds.begin(), inds.end());
+	assert(std::unique(inds.begin(), inds.end()) == inds.end());
+
+	inds.push_back(dim);
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+	assert(std::abs(g(Features<float64_t>::copy_cov(cov, inds)) - result.first) < 1E-10);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/computation/SubsetCache.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LocalSearch.hpp>
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include "RandomCovariance.hpp"
+#include <vector>
+#include <cmath>
+
+using namespace tesseract;
+using namespace Eigen;
+
+void test1()
+{
+	SubsetCache<float64_t> cache(2);
+	float64_t value = 0;
+
+	assert(!cache.find({1, 2}, value));
+	cache.insert({2, 1}, 0.5);
+
+	// the order of the indices doesn't matter
+	assert(cache.find({1, 2}, value));
+	assert(value == 0.5);
+
+	// {3} evicts {4}, the least recently used one
+	cache.insert({4}, 1.5);
+	assert(cache.find({1, 2}, value));
+	cache.insert({3}, 2.5);
+	assert(cache.size() == 2);
+	assert(!cache.find({4}, value));
+	assert(cache.find({3}, value));
+	assert(value == 2.5);
+
+	assert(cache.get_num_hits() == 3);
+	assert(cache.get_num_misses() == 2);
+
+	cache.clear();
+	assert(cache.size() == 0);
+	assert(cache.get_num_hits() == 0);
+	assert(cache.get_num_misses() == 0);
+}
+
+void test2()
+{
+	MatrixXd cov = random_cov(20, 11);
+
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	std::vector<index_t> inds = {1, 4, 7, 10};
+	float64_t expected = g(IndexedCovariance<float64_t>(cov, inds));
+
+	SubsetCache<float64_t> cache;
+	g.set_cache(&cache);
+	assert(g(IndexedCovariance<float64_t>(cov, inds)) == expected);
+	assert(g(IndexedCovariance<float64_t>(cov, inds)) == expected);
+	assert(cache.get_num_misses() == 1);
+	assert(cache.get_num_hits() == 1);
+
+	// the indices of a submatrix are mapped to the ones of cov
+	std::vector<index_t> index_map = {0, 1, 4, 7, 10};
+	MatrixXd sub_cov(5, 5);
+	for (index_t i = 0; i < 5; ++i)
+		for (index_t j = 0; j < 5; ++j)
+			sub_cov(i, j) = cov(index_map[i], index_map[j]);
+
+	std::vector<index_t> sub_inds = {1, 2, 3, 4};
+	g.set_cache(&cache, &index_map);
+	assert(g(IndexedCovariance<float64_t>(sub_cov, sub_inds)) == expected);
+	assert(cache.get_num_hits() == 2);
+}
+
+void test3()
+{
+	typedef GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t> GLS;
+
+	MatrixXd cov = random_cov(100, 41);
+
+	GLS::param_type params(0.5, SmoothedDifferentialEntropyParam<float64_t>(0.5));
+
+	GLS gls(cov, 8);
+	gls.set_params(params);
+	auto expected = gls.run();
+
+	// the cache doesn't change the result
+	SubsetCache<float64_t> cache;
+	GLS cached_gls(cov, 8);
+	cached_gls.set_params(params);
+	cached_gls.set_cache(&cache);
+	auto result = cached_gls.run();
+	assert(result.second == expected.second);
+	assert(std::abs(result.first - expected.first) < 1e-10);
+
+	// a second run evaluates nothing new
+	index_t num_misses = cache.get_num_misses();
+	assert(num_misses > 0);
+	result = cached_gls.run();
+	assert(result.second == expected.second);
+	assert(cache.get_num_misses() == num_misses);
+	assert(cache.get_num_hits() >= num_misses);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	test3();
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/algorithm/SwapLocalSearch.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/features/Features.hpp>
+#include "RandomCovariance.hpp"
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+
+using namespace tesseract;
+using namespace Eigen;
+
+float64_t evaluate(const MatrixXd& cov, std::vector<index_t> inds, float64_t eta,
+		SmoothedDifferentialEntropyParam<float64_t> reg_params)
+{
+	ComputeFunction<SmoothedDifferentialEntropy, float64_t> g;
+	g.set_eta(eta);
+	g.set_reg_params(reg_params);
+	inds.push_back(cov.cols() - 1);
+	return g(Features<float64_t>::copy_cov(cov, inds));
+}
+
+void test1()
+{
+	int dim = 40;
+	int N = 30;
+	index_t k = 8;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	float64_t eta = 0.1;
+	SmoothedDifferentialEntropyParam<float64_t> reg_params(0.5);
+
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+	fr.set_params(ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type(eta, reg_params));
+	std::pair<float64_t,std::vector<index_t>> initial = fr.run();
+
+	typedef SwapLocalSearch<SmoothedDifferentialEntropy, float64_t>::param_type param_type;
+	param_type params(eta, reg_params);
+	params.num_threads = 3;
+
+	SwapLocalSearch<SmoothedDifferentialEntropy, float64_t> sls(cov);
+	sls.set_params(params);
+	sls.set_initial(initial.second);
+	std::pair<float64_t,std::vector<index_t>> result = sls.run();
+
+	// the swaps keep the size and improve on forward regression here
+	assert(result.second.size() == k);
+	assert(result.first > initial.first);
+	assert(std::abs(result.first - evaluate(cov, result.second, eta, reg_params)) < 1E-10);
+
+	// the result is a local optimum with respect to 1-swaps
+	for (index_t p = 0; p < k; ++p)
+	{
+		for (index_t j = 0; j < dim; ++j)
+		{
+			if (std::find(result.second.begin(), result.second.end(), j) != result.second.end())
+				continue;
+
+			std::vector<index_t> swapped(result.second);
+			swapped[p] = j;
+			assert(evaluate(cov, swapped, eta, reg_params) <= result.first + 1E-10);
+		}
+	}
+
+	// without an initial set, forward regression is run first
+	SwapLocalSearch<SmoothedDifferentialEntropy, float64_t> sls_fr(cov, k);
+	sls_fr.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> result_fr = sls_fr.run();
+	assert(result_fr.second == result.second);
+	assert(std::abs(result_fr.first - result.first) < 1E-10);
+
+	// a single swap changes one feature
+	params.max_iters = 1;
+	sls.set_params(params);
+	std::pair<float64_t,std::vector<index_t>> one_swap = sls.run();
+
+	std::vector<index_t> sorted_initial(initial.second);
+	std::sort(sorted_initial.begin(), sorted_initial.end());
+	std::vector<index_t> diff;
+	std::set_difference(one_swap.second.begin(), one_swap.second.end(),
+			sorted_initial.begin(), sorted_initial.end(), std::back_inserter(diff));
+	assert(diff.size() == 1);
+	assert(one_swap.first >= initial.first - 1E-10);
+	assert(one_swap.first <= result.first + 1E-10);
+}
+
+void test2()
+{
+	int dim = 20;
+	int N = 40;
+	index_t k = 4;
+	MatrixXd cov = random_cov(N, dim + 1);
+
+	float64_t eta = 0.1;
+	SmoothedDifferentialEntropyParam<float64_t> reg_params(0.5);
+
+	ForwardRegression<SmoothedDifferentialEntropy, float64_t> fr(cov, k);
+	fr.set_params(ForwardRegression<SmoothedDifferentialEntropy, float64_t>::param_type(eta, reg_params));
+	float64_t g_fr = fr.run().first;
+
+	// as the local search phase of greedy local search
+	typedef GreedyLocalSearch<ForwardRegression, SwapLocalSearch, SmoothedDifferentialEntropy, float64_t> gls_type;
+	gls_type gls(cov, k);
+	gls.set_params(gls_type::param_type(eta, reg_params));
+	std::pair<float64_t,std::vector<index_t>> result = gls.run();
+
+	assert(result.second.size() == k);
+	assert(result.first >= g_fr - 1E-10);
+	assert(std::abs(result.first - evaluate(cov, result.second, eta, reg_params)) < 1E-10);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2();
+	return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/io/TextReader.hpp>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+using namespace tesseract;
+
+void test1()
+{
+	// the parsed values are the same as the ones of strtod
+	std::vector<std::string> numbers = {"0", "-0", "0.00632", "18.00", "396.90",
+		"-1.5e-3", "4.9E+2", "+3", ".5", "5.", "0.1", "1e23", "9007199254740993",
+		"123456789012345678901234", "0.20103656", "2.2250738585072014e-308"};
+	for (const std::string& number : numbers)
+	{
+		const char* first = number.data();
+		float64_t value;
+		assert(TextReader::parse_float(first, number.data() + number.size(), value));
+		assert(first == number.data() + number.size());
+		assert(value == std::strtod(number.c_str(), nullptr));
+	}
+
+	// not numbers
+	std::vector<std::string> invalid = {"", "-", ".", "abc", "e5", "1e"};
+	for (const std::string& text : invalid)
+	{
+		const char* first = text.data();
+		float64_t value;
+		assert(!TextReader::parse_float(first, text.data() + text.size(), value));
+	}
+}
+
+void test2(std::string filename, int32_t num_images, int32_t num_features)
+{
+	TextReader serial_reader(filename, 1);
+	serial_reader.load();
+
+	assert(serial_reader.get_num_images() == num_images);
+	assert(serial_reader.get_num_labels() == num_images);
+	assert(serial_reader.get_num_features() == num_features);
+
+	// parsing in parallel gives the same result
+	TextReader reader(filename, 8);
+	reader.load();
+
+	assert(reader.get_num_images() == num_images);
+	for (index_t i = 0; i < num_images; ++i)
+	{
+		assert(reader.get_image(i) == serial_reader.get_image(i));
+		assert(reader.get_label(i) == serial_reader.get_label(i));
+	}
+
+	// so does parsing only some of the lines after counting them
+	TextReader sampled_reader(filename, 8);
+	sampled_reader.load_header();
+	assert(sampled_reader.get_num_images() == num_images);
+	assert(sampled_reader.get_num_features() == num_features);
+
+	std::vector<int32_t> indices = {0, 1, 1, num_images / 2, num_images - 1};
+	sampled_reader.load(indices);
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		assert(sampled_reader.get_image(k) == serial_reader.get_image(indices[k]));
+		assert(sampled_reader.get_label(k) == serial_reader.get_label(indices[k]));
+	}
+}
+
+void test3()
+{
+	// commas, CRLF line endings, empty lines and no trailing newline
+	char filename[] = "/tmp/textXXXXXX";
+	int fd = mkstemp(filename);
+	assert(fd >= 0);
+	close(fd);
+
+	std::ofstream os(filename);
+	os << "1,2,3\r\n\n4, 5, 6\r\n 7 8 9\n\n10;11;12";
+	os.close();
+
+	TextReader reader(filename, 3);
+	reader.load_header();
+	assert(reader.get_num_images() == 4);
+	assert(reader.get_num_features() == 2);
+
+	std::vector<int32_t> indices = {1, 3, 3};
+	reader.load(indices);
+	assert(reader.get_num_images() == 3);
+
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		TextReader::vec_type& feat = reader.get_image(k);
+		assert(feat.size() == 2);
+		assert(feat[0] == 3 * indices[k] + 1);
+		assert(feat[1] == 3 * indices[k] + 2);
+		assert(reader.get_label(k) == 3 * indices[k] + 3);
+	}
+
+	std::remove(filename);
+}
+
+int main(int argc, char** argv)
+{
+	test1();
+	test2("data/housing.data", 506, 13);
+	test2("data/blog_feedback_test.data", 115, 280);
+	test3();
+	return 0;
+}
@@ -24,6 +24,7 @@
 
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
 #include <iostream>
+#include <cassert>
 
 using namespace tesseract;
 using namespace Eigen;
@@ -48,9 +49,26 @@ void test2()
 //	std::cout << m.norm() << std::endl;
 }
 
+void test3()
+{
+	MatrixXd m = MatrixXd::Random(10,4);
+	m.col(2).setZero();
+	MatrixXd gram = m.transpose() * m;
+
+	UnitL2Normalizer<MatrixXd> normalizer;
+	normalizer.normalize(m);
+	normalizer.normalize_gram(gram);
+
+	// only the lower triangle is normalized
+	MatrixXd expected = m.transpose() * m;
+	MatrixXd diff = (gram - expected).triangularView<Lower>();
+	assert(diff.norm() < 1E-12);
+}
+
 int main(int argc, char** argv)
 {
 	test1();
 	test2();
+	test3();
 	return 0;
 }
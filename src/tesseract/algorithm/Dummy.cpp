@@ -24,6 +24,7 @@
 
 #include <tesseract/algorithm/Dummy.hpp>
 #include <algorithm>
+#include <numeric>
 #include <map>
 
 using namespace tesseract;
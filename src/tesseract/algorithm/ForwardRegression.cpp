@@ -23,12 +23,13 @@
  */
 
 #include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
 #include <tesseract/algorithm/ForwardRegression.hpp>
 #include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
-#include <tesseract/features/Features.hpp>
 #include <vector>
 #include <map>
 
@@ -36,14 +37,14 @@ using namespace tesseract;
 
 template <template <class> class Regularizer, typename T>
 ForwardRegressionParam<Regularizer, T>::ForwardRegressionParam()
-: eta(ComputeFunction<Regularizer,T>::default_eta)
+: eta(ComputeFunction<Regularizer,T>::default_eta), num_threads(1), mixed_precision(false)
 {
 }
 
 template <template <class> class Regularizer, typename T>
 ForwardRegressionParam<Regularizer, T>::ForwardRegressionParam(T _eta,
 		ForwardRegressionParam<Regularizer,T>::reg_param_type reg_params)
-: eta(_eta), regularizer_params(reg_params)
+: eta(_eta), regularizer_params(reg_params), num_threads(1), mixed_precision(false)
 {
 }
 
@@ -67,12 +68,38 @@ ForwardRegression<Regularizer,T>::~ForwardRegression()
 
 template <template <class> class Regularizer, typename T>
 std::pair<T,std::vector<index_t>> ForwardRegression<Regularizer,T>::run()
+{
+	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
+
+	if (target_feats == 0)
+	{
+		return std::make_pair(0, std::vector<index_t>());
+	}
+
+	// the last entry of the path is the result for target_feats
+	return run_path(target_feats).back();
+}
+
+template <template <class> class Regularizer, typename T>
+std::vector<std::pair<T,std::vector<index_t>>> ForwardRegression<Regularizer,T>::run_path(index_t k_max)
+{
+	if (params.mixed_precision)
+	{
+		return greedy_path<float64_t>(k_max);
+	}
+
+	return greedy_path<T>(k_max);
+}
+
+template <template <class> class Regularizer, typename T>
+template <typename Acc>
+std::vector<std::pair<T,std::vector<index_t>>> ForwardRegression<Regularizer,T>::greedy_path(index_t k_max)
 {
 	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
 	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
 	logger.write(MemDebug, "cov.rows = %u!\n", cov.rows());
 	logger.write(MemDebug, "cov.cols = %u!\n", cov.cols());
-	logger.write(MemDebug, "target features = %u!\n", target_feats);
+	logger.write(MemDebug, "max target features = %u!\n", k_max);
 
 	// number of feats
 	index_t N = cov.cols() - 1;
@@ -83,66 +110,89 @@ std::pair<T,std::vector<index_t>> ForwardRegression<Regularizer,T>::run()
 		logger.print_matrix(cov);
 	}
 
-	// create the compute function
-	ComputeFunction<Regularizer, T> g;
+	// create the compute function which keeps the Cholesky factor of C_S
+	// across the rounds so that each candidate costs one triangular solve
+	IncrementalComputeFunction<Regularizer, T, Acc> g(cov, k_max);
 	g.set_eta(params.eta);
 	g.set_reg_params(params.regularizer_params);
 
-	// return vector - indices of selected features
-	std::vector<index_t> inds;
+	// the candidates are evaluated in parallel on contiguous chunks, each
+	// thread having its own scratch memory and running argmax
+	ThreadPool pool(params.num_threads);
+	index_t num_chunks = pool.get_num_threads();
+	std::vector<typename IncrementalComputeFunction<Regularizer, T, Acc>::Workspace> work(num_chunks);
+	std::vector<std::pair<T,index_t>> chunk_max(num_chunks);
+
+	// the candidates of a chunk and their values, which are scored as a batch
+	std::vector<std::vector<index_t>> candidates(num_chunks);
+	std::vector<Vector<T>> values(num_chunks);
 
 	// status vector to avoid overchecking
 	std::vector<bool> selected(N);
 	std::fill(selected.begin(), selected.end(), false);
 
-	// final function value
-	T maxval = 0;
+	// the greedy choice for k features doesn't depend on the target, so the
+	// result for every k is recorded on the way to k_max
+	std::vector<std::pair<T,std::vector<index_t>>> path;
+	path.reserve(k_max);
 
-	// main loop runs until target_feats features are added
+	// main loop runs until k_max features are added
 	// cannot be parallelised since addition happens serially
-	for (index_t i = 0; i < target_feats; ++i)
+	for (index_t i = 0; i < k_max; ++i)
 	{
-		// store the values for argmax operation
-		maxval = 0;
-		index_t argmax = -1;
-
-		// can be parallelised
-		for (index_t j = 0; j < N; ++j)
+		pool.parallel_for(N, [&](index_t t, index_t begin, index_t end)
 		{
-			if (!selected[j])
-			{
-				// note that in case of parallel, inds should have individual copies
-				// the following indices are for C_S
-				std::vector<index_t> cur_inds(inds);
-				cur_inds.push_back(j);
+			// store the values for argmax operation
+			T local_maxval = 0;
+			index_t local_argmax = -1;
 
-				// remember to push the index of last column
-				// since we need b_S also for compute function
-				cur_inds.push_back(N);
-
-				// evaluate the function
-				Matrix<float64_t> c_s = Features<T>::copy_cov(cov, cur_inds);
-
-				logger.write(MemDebug, "for indices\n");
-				if (logger.get_loglevel() >= MemDebug)
+			candidates[t].clear();
+			for (index_t j = begin; j < end; ++j)
+			{
+				if (!selected[j])
 				{
-					logger.print_vector(cur_inds);
+					candidates[t].push_back(j);
 				}
-				logger.write(MemDebug, "cov.data in use = %p!\n", c_s.data());
-				if (logger.get_loglevel() >= MemDebug)
+			}
+
+			// evaluate the function on S + j for all the candidates of the chunk
+			values[t].resize(candidates[t].size());
+			g.score_extensions(candidates[t], values[t], work[t]);
+
+			for (index_t c = 0; c < candidates[t].size(); ++c)
+			{
+				// update running max of the chunk
+				if (values[t][c] > local_maxval)
 				{
-					logger.print_matrix(c_s);
+					local_maxval = values[t][c];
+					local_argmax = candidates[t][c];
 				}
+			}
 
-				T val = g(c_s);
-				logger.write(Debug, "j = %u, val = %f, maxval = %f, argmax = %u!\n",
-						j, val, maxval, argmax);
+			chunk_max[t] = std::make_pair(local_maxval, local_argmax);
+		});
 
-				// update running max, need to be write protected
-				if (val > maxval)
+		// reduce in the order of the chunks so that ties are broken towards
+		// the smallest index, exactly as in a serial run
+		T maxval = 0;
+		index_t argmax = -1;
+		for (index_t t = 0; t < num_chunks; ++t)
+		{
+			if (chunk_max[t].first > maxval)
+			{
+				maxval = chunk_max[t].first;
+				argmax = chunk_max[t].second;
+			}
+		}
+
+		// the values are logged after the batch, outside of the threads
+		if (logger.get_loglevel() >= Debug)
+		{
+			for (index_t t = 0; t < num_chunks; ++t)
+			{
+				for (index_t c = 0; c < candidates[t].size(); ++c)
 				{
-					maxval = val;
-					argmax = j;
+					logger.write(Debug, "j = %u, val = %f!\n", candidates[t][c], values[t][c]);
 				}
 			}
 		}
@@ -153,11 +203,19 @@ std::pair<T,std::vector<index_t>> ForwardRegression<Regularizer,T>::run()
 		assert(argmax != -1);
 
 		// update the working set
-		inds.push_back(argmax);
+		g.add(argmax);
 		selected[argmax] = true;
+
+		if (logger.get_loglevel() >= MemDebug)
+		{
+			logger.print_vector(g.get_inds());
+		}
+
+		// function value and indices of selected features for i + 1 features
+		path.push_back(std::make_pair(maxval, g.get_inds()));
 	}
 
-	return std::make_pair(maxval, inds);
+	return path;
 }
 
 template <template <class> class Regularizer, typename T>
@@ -172,3 +230,10 @@ template class ForwardRegressionParam<SpectralVariance, float64_t>;
 template class ForwardRegression<DummyRegularizer, float64_t>;
 template class ForwardRegression<SmoothedDifferentialEntropy, float64_t>;
 template class ForwardRegression<SpectralVariance, float64_t>;
+
+template class ForwardRegressionParam<DummyRegularizer, float32_t>;
+template class ForwardRegressionParam<SmoothedDifferentialEntropy, float32_t>;
+template class ForwardRegressionParam<SpectralVariance, float32_t>;
+template class ForwardRegression<DummyRegularizer, float32_t>;
+template class ForwardRegression<SmoothedDifferentialEntropy, float32_t>;
+template class ForwardRegression<SpectralVariance, float32_t>;
@@ -48,6 +48,14 @@ struct ForwardRegressionParam
 
 	/** regularizer params */
 	reg_param_type regularizer_params;
+
+	/** number of threads for evaluating the candidates (0 uses all cores) */
+	index_t num_threads;
+
+	/** whether the solves accumulate in float64_t for a float32_t covariance
+	 * matrix, i.e. single precision storage with double precision solves
+	 */
+	bool mixed_precision;
 };
 
 /** @brief class ForwardRegression for a dummy algorithm which does nothing and returns
@@ -72,15 +80,29 @@ public:
 	/** @return a pair of the function value and selected feature indices */
 	std::pair<T,std::vector<index_t>> run();
 
+	/** runs the algorithm once for all the number of target features up to k_max.
+	 * The features are added greedily, so the selection for k features is the
+	 * prefix of the selection for any larger k
+	 *
+	 * @param k_max maximum number of target features
+	 * @return pairs of the function value and selected feature indices, the k-th
+	 * entry (0-based) being the result for k + 1 target features
+	 */
+	std::vector<std::pair<T,std::vector<index_t>>> run_path(index_t k_max);
+
 	/** @param param the parameter type */
 	void set_params(param_type _params);
 
 private:
+	/** @see run_path(), with the solves accumulating in Acc */
+	template <typename Acc>
+	std::vector<std::pair<T,std::vector<index_t>>> greedy_path(index_t k_max);
+
 	/** parameters */
 	param_type params;
 
 	/** real valued dense covariance matrix */
-	const Eigen::Ref<const Matrix<float64_t>> cov;
+	const Eigen::Ref<const Matrix<T>> cov;
 
 	/** number of target features */
 	index_t target_feats;
@@ -23,11 +23,17 @@
  */
 
 #include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
 #include <tesseract/algorithm/GreedyLocalSearch.hpp>
 #include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LazyForwardRegression.hpp>
+#include <tesseract/algorithm/StochasticForwardRegression.hpp>
+#include <tesseract/algorithm/OrthogonalMatchingPursuit.hpp>
 #include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/algorithm/LinearLocalSearch.hpp>
+#include <tesseract/algorithm/SwapLocalSearch.hpp>
 #include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/SubsetCache.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
@@ -39,6 +45,116 @@
 
 using namespace tesseract;
 
+namespace
+{
+
+/** @brief the local search phase of GreedyLocalSearch, which runs LSAlgo on
+ * the covariance matrix of the features S_1 selected by the first forward
+ * regression and returns a subset of them
+ */
+template <template<template<class>class,typename> class LSAlgo,
+		 template <class> class Regularizer, typename T>
+struct LocalSearchPhase
+{
+	/**
+	 * @param cov the covariance matrix
+	 * @param S_1_inds the sorted indices of S_1
+	 * @param g_S_1 the function value of S_1
+	 * @param params the parameters of LSAlgo
+	 * @param cache the cache of the objective values (may be nullptr)
+	 * @param useful whether LSAlgo found another set than S_1
+	 * @return the function value and selected feature indices, which are
+	 * mapped to the indices of cov only if useful is set
+	 */
+	static std::pair<T,std::vector<index_t>> run(const Eigen::Ref<const Matrix<T>>& cov,
+			const std::vector<index_t>& S_1_inds, T g_S_1,
+			typename LSAlgo<Regularizer,T>::param_type params,
+			SubsetCache<T>* cache, bool& useful)
+	{
+		// make sure to include the last column
+		std::vector<index_t> inds(S_1_inds);
+		inds.push_back(cov.cols() - 1);
+
+		logger.write(Debug, "For LS, copying cov with indices\n");
+		if (logger.get_loglevel() >= Debug)
+		{
+			logger.print_vector(inds);
+		}
+
+		Matrix<T> cov_S_1 = Features<T>::copy_cov(cov, inds);
+		LSAlgo<Regularizer,T> ls(cov_S_1);
+		ls.set_params(params);
+
+		// LS evaluates subsets of S_1, which are mapped back to the indices of
+		// cov for the cache
+		if (cache != nullptr)
+		{
+			cache->insert(inds, g_S_1);
+			ls.set_cache(cache, &inds);
+		}
+
+		// make use of the function value we just computed using FR
+		ls.set_global_value(g_S_1);
+
+		std::pair<T,std::vector<index_t>> S_p = ls.run();
+
+		logger.write(Debug, "Relative indices returned by LS\n");
+		if (logger.get_loglevel() >= Debug)
+		{
+			logger.print_vector(S_p.second);
+		}
+
+		// if returned set is of same size as of S_1, don't bother
+		// otherwise, since the above returned indices are mapped, we need to map it back
+		useful = S_p.second.size() > 0 && S_p.second.size() < S_1_inds.size();
+		if (useful)
+		{
+			std::sort(S_p.second.begin(), S_p.second.end());
+			std::for_each(S_p.second.begin(), S_p.second.end(), [&S_1_inds](index_t& val)
+			{
+				val = S_1_inds[val];
+			});
+		}
+
+		return S_p;
+	}
+};
+
+/** @brief the local search phase of GreedyLocalSearch with SwapLocalSearch,
+ * which exchanges the features of S_1 with the rest of the features of the
+ * covariance matrix
+ */
+template <template <class> class Regularizer, typename T>
+struct LocalSearchPhase<SwapLocalSearch, Regularizer, T>
+{
+	/** see LocalSearchPhase::run(), the indices are always the ones of cov.
+	 * The value of S_1 isn't needed, SwapLocalSearch computes it anyway
+	 * while building the incremental state of S_1
+	 */
+	static std::pair<T,std::vector<index_t>> run(const Eigen::Ref<const Matrix<T>>& cov,
+			const std::vector<index_t>& S_1_inds, T,
+			typename SwapLocalSearch<Regularizer,T>::param_type params,
+			SubsetCache<T>* cache, bool& useful)
+	{
+		SwapLocalSearch<Regularizer,T> ls(cov, S_1_inds.size());
+		ls.set_params(params);
+		ls.set_initial(S_1_inds);
+		ls.set_cache(cache);
+
+		std::pair<T,std::vector<index_t>> S_p = ls.run();
+
+		// the swaps keep the size, so LS was useful if any swap was made.
+		// comparing the sets as vectors relies on both of them being sorted,
+		// S_1_inds by the caller and the returned indices by SwapLocalSearch
+		assert(std::is_sorted(S_1_inds.begin(), S_1_inds.end()));
+		assert(std::is_sorted(S_p.second.begin(), S_p.second.end()));
+		useful = S_p.second.size() > 0 && S_p.second != S_1_inds;
+		return S_p;
+	}
+};
+
+}
+
 template <template<template<class>class,typename> class FRAlgo,
 		 template <template<class>class,typename> class LSAlgo,
 		 template <class> class Regularizer, typename T>
@@ -48,6 +164,7 @@ GreedyLocalSearchParam<FRAlgo,LSAlgo,Regularizer,T>::GreedyLocalSearchParam()
 	regularizer_params = reg_param_type();
 	fr_params = fr_param_type(eta,regularizer_params);
 	ls_params = ls_param_type(eta,regularizer_params);
+	num_threads = 1;
 }
 
 template <template<template<class>class,typename> class FRAlgo,
@@ -59,6 +176,7 @@ GreedyLocalSearchParam<FRAlgo,LSAlgo,Regularizer,T>::GreedyLocalSearchParam(ls_p
 	regularizer_params = _ls_params.regularizer_params;
 	ls_params = _ls_params;
 	fr_params = fr_param_type(eta,regularizer_params);
+	num_threads = 1;
 }
 
 template <template<template<class>class,typename> class FRAlgo,
@@ -71,6 +189,7 @@ GreedyLocalSearchParam<FRAlgo,LSAlgo,Regularizer,T>::GreedyLocalSearchParam(T _e
 	regularizer_params = _regularizer_params;
 	fr_params = fr_param_type(eta,regularizer_params);
 	ls_params = ls_param_type(eta,regularizer_params);
+	num_threads = 1;
 }
 
 template <template<template<class>class,typename> class FRAlgo,
@@ -78,7 +197,7 @@ template <template<template<class>class,typename> class FRAlgo,
 		 template <class> class Regularizer, typename T>
 GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>::GreedyLocalSearch(const Eigen::Ref<const Matrix<T>>& _cov,
 		index_t _target_feats)
-: cov(_cov), target_feats(_target_feats)
+: cov(_cov), target_feats(_target_feats), cache(nullptr), has_fr_result(false)
 {
 	logger.write(MemDebug, "In %s\n", __PRETTY_FUNCTION__);
 	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
@@ -110,10 +229,19 @@ std::pair<T,std::vector<index_t>> GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>
 	index_t N = cov.cols() - 1;
 	logger.write(Debug, "total feats = %u!\n", N);
 
-	// run forward regression on the whole data
-	FRAlgo<Regularizer,T> fr(cov, target_feats);
-	fr.set_params(params.fr_params);
-	std::pair<T,std::vector<index_t>> S_1 = fr.run();
+	// run forward regression on the whole data unless its result is given
+	std::pair<T,std::vector<index_t>> S_1;
+	if (has_fr_result)
+	{
+		assert(fr_result.second.size() == target_feats);
+		S_1 = fr_result;
+	}
+	else
+	{
+		FRAlgo<Regularizer,T> fr(cov, target_feats);
+		fr.set_params(params.fr_params);
+		S_1 = fr.run();
+	}
 	T g_S_1 = S_1.first;
 	std::vector<index_t> S_1_inds = S_1.second;
 
@@ -136,97 +264,44 @@ std::pair<T,std::vector<index_t>> GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>
 			});
 		};
 
-	// run local search on the returned set
-	// make sure to include the last column
-	S_1_inds.push_back(N);
+	// LS only depends on S_1 and so does the 2nd phase of forward regression,
+	// so both run concurrently on the pool
+	ThreadPool pool(params.num_threads);
 
-	logger.write(Debug, "For LS, copying cov with indices\n");
-	if (logger.get_loglevel() >= Debug)
-	{
-		logger.print_vector(S_1_inds);
-	}
-
-	Matrix<T> cov_S_1 = Features<T>::copy_cov(cov, S_1_inds);
-	LSAlgo<Regularizer,T> ls(cov_S_1);
-	ls.set_params(params.ls_params);
-
-	// make use of the function value we just computed using FR
-	ls.set_global_value(g_S_1);
-
-	// track the time taken by the LS algorithm
-
-	// set timers
-	const auto cpu0 = std::chrono::high_resolution_clock::now();
-
-	std::pair<T,std::vector<index_t>> S_p = ls.run();
-
-	// stop timers
-	const auto cpu1 = std::chrono::high_resolution_clock::now();
-	const auto cpu_elapsed = cpu1 - cpu0;
-
-	logger.write(Special, "%.10f ", std::chrono::duration<float64_t>(cpu_elapsed).count());
-	T g_S_p = S_p.first;
-
-	logger.write(Special, "%.10f ", g_S_p);
-
-	std::vector<index_t> S_p_inds = S_p.second;
-
-	logger.write(Debug, "LS(S_1) = %f!\n", g_S_p);
-	logger.write(Debug, "Relative indices returned by LS\n");
-	if (logger.get_loglevel() >= Debug)
-	{
-		logger.print_vector(S_p_inds);
-	}
-
-	// pop back the last column from the index set
-	S_1_inds.pop_back();
+	// run local search on the returned set
+	bool ls_useful = false;
+	std::pair<T,std::vector<index_t>> S_p;
+	float64_t ls_time = 0;
 
-	// if returned set is of same size as of S_1, don't bother
-	// otherwise, since the above returned indices are mapped, we need to map it back
-	bool ls_useful = S_p_inds.size() > 0 && S_p_inds.size() < S_1_inds.size();
-	if (ls_useful)
+	std::future<void> ls_task = pool.submit([&]()
 	{
-		// whether LS was useful
-		logger.write(Special, "+ ");
+		// track the time taken by the LS algorithm
 
-		std::sort(S_p_inds.begin(), S_p_inds.end());
-		inds_map(S_1_inds, S_p_inds);
+		// set timers
+		const auto cpu0 = std::chrono::high_resolution_clock::now();
 
-		logger.write(Debug, "Actual indices returned by LS\n");
-		if (logger.get_loglevel() >= Debug)
-		{
-			logger.print_vector(S_p_inds);
-		}
-	}
-	else
-	{
-		// whether LS was useful
-		logger.write(Special, "- ");
-	}
+		S_p = LocalSearchPhase<LSAlgo,Regularizer,T>::run(cov, S_1_inds, g_S_1,
+				params.ls_params, cache, ls_useful);
 
-	// return inds
-	std::vector<index_t>& argmax = S_1_inds;
-	T maxval = g_S_1;
-
-	enum Selected { FR1, LS, FR2 };
-	Selected selected = FR1;
-
-	if (maxval < g_S_p)
-	{
-		selected = LS;
-		maxval = g_S_p;
-		argmax = S_p_inds;
-	}
+		// stop timers
+		const auto cpu1 = std::chrono::high_resolution_clock::now();
+		const auto cpu_elapsed = cpu1 - cpu0;
+		ls_time = std::chrono::duration<float64_t>(cpu_elapsed).count();
+	});
 
 	// run 2nd phase of forward regression only when enough rest features are there
-	if (N >= target_feats * 2)
+	bool has_S_2 = N >= target_feats * 2;
+	T g_S_2 = 0;
+	std::vector<index_t> S_2_inds;
+
+	if (has_S_2)
 	{
 		// compute the rest of indices
 		std::vector<index_t> rest;
 		index_t in_s1 = 0;
 		for (index_t i = 0; i < N; ++i)
 		{
-			if (S_1_inds[in_s1] == i)
+			if (in_s1 < S_1_inds.size() && S_1_inds[in_s1] == i)
 				in_s1++;
 			else
 				rest.push_back(i);
@@ -255,8 +330,8 @@ std::pair<T,std::vector<index_t>> GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>
 		fr2.set_params(params.fr_params);
 
 		std::pair<T,std::vector<index_t>> S_2 = fr2.run();
-		T g_S_2 = S_2.first;
-		std::vector<index_t> S_2_inds = S_2.second;
+		g_S_2 = S_2.first;
+		S_2_inds = S_2.second;
 
 		// pop back last column index from rest
 		rest.pop_back();
@@ -272,19 +347,68 @@ std::pair<T,std::vector<index_t>> GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>
 		std::sort(S_2_inds.begin(), S_2_inds.end());
 		inds_map(rest, S_2_inds);
 
+		if (cache != nullptr)
+		{
+			S_2_inds.push_back(N);
+			cache->insert(S_2_inds, g_S_2);
+			S_2_inds.pop_back();
+		}
+
 		logger.write(Debug, "Actual indices returned by FR\n");
 		if (logger.get_loglevel() >= Debug)
 		{
 			logger.print_vector(S_2_inds);
 		}
+	}
+
+	pool.wait(ls_task);
+
+	logger.write(Special, "%.10f ", ls_time);
+	T g_S_p = S_p.first;
+
+	logger.write(Special, "%.10f ", g_S_p);
 
-		if (maxval < g_S_2)
+	std::vector<index_t> S_p_inds = S_p.second;
+
+	logger.write(Debug, "LS(S_1) = %f!\n", g_S_p);
+
+	if (ls_useful)
+	{
+		// whether LS was useful
+		logger.write(Special, "+ ");
+
+		logger.write(Debug, "Actual indices returned by LS\n");
+		if (logger.get_loglevel() >= Debug)
 		{
-			selected = FR2;
-			maxval = g_S_2;
-			argmax = S_2_inds;
+			logger.print_vector(S_p_inds);
 		}
 	}
+	else
+	{
+		// whether LS was useful
+		logger.write(Special, "- ");
+	}
+
+	// return inds
+	std::vector<index_t> argmax = S_1_inds;
+	T maxval = g_S_1;
+
+	enum Selected { FR1, LS, FR2 };
+	Selected selected = FR1;
+
+	if (maxval < g_S_p)
+	{
+		selected = LS;
+		maxval = g_S_p;
+		argmax = S_p_inds;
+	}
+
+	if (has_S_2 && maxval < g_S_2)
+	{
+		selected = FR2;
+		maxval = g_S_2;
+		argmax = S_2_inds;
+	}
 
 	// special debug messages
 	// - 0 for FR1 was selected
@@ -304,6 +428,23 @@ void GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>::set_params(param_type _para
 	params = _params;
 }
 
+template <template<template<class>class,typename> class FRAlgo,
+		 template <template<class>class,typename> class LSAlgo,
+		 template <class> class Regularizer, typename T>
+void GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>::set_cache(SubsetCache<T>* _cache)
+{
+	cache = _cache;
+}
+
+template <template<template<class>class,typename> class FRAlgo,
+		 template <template<class>class,typename> class LSAlgo,
+		 template <class> class Regularizer, typename T>
+void GreedyLocalSearch<FRAlgo,LSAlgo,Regularizer,T>::set_fr_result(const std::pair<T,std::vector<index_t>>& _fr_result)
+{
+	fr_result = _fr_result;
+	has_fr_result = true;
+}
+
 template class GreedyLocalSearchParam<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
 template class GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
 
@@ -315,3 +456,99 @@ template class GreedyLocalSearch<ForwardRegression,LocalSearch,SpectralVariance,
 
 template class GreedyLocalSearchParam<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
 template class GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,SwapLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<ForwardRegression,SwapLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,SwapLocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<ForwardRegression,SwapLocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LinearLocalSearch,SpectralVariance,float64_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LinearLocalSearch,SpectralVariance,float64_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,SwapLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,SwapLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<ForwardRegression,SwapLocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<ForwardRegression,SwapLocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<LazyForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<LazyForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<StochasticForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<StochasticForwardRegression,LinearLocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float32_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LinearLocalSearch,SmoothedDifferentialEntropy,float32_t>;
+
+template class GreedyLocalSearchParam<OrthogonalMatchingPursuit,LinearLocalSearch,SpectralVariance,float32_t>;
+template class GreedyLocalSearch<OrthogonalMatchingPursuit,LinearLocalSearch,SpectralVariance,float32_t>;
@@ -30,6 +30,8 @@
 namespace tesseract
 {
 
+template <typename T> class SubsetCache;
+
 /** @brief struct for parameters used in greedy local-search */
 template <template<template<class>class,typename> class FRAlgo,
 		 template <template<class>class,typename> class LSAlgo,
@@ -65,6 +67,12 @@ struct GreedyLocalSearchParam
 
 	/** local search params */
 	ls_param_type ls_params;
+
+	/** number of threads for running the local search and the 2nd phase of
+	 * forward regression concurrently (1 runs them one after the other,
+	 * which is the default)
+	 */
+	index_t num_threads;
 };
 
 /** @brief class GreedyLocalSearch for a dummy algorithm which does nothing and returns
@@ -95,15 +103,41 @@ public:
 	/** @param param the parameter type */
 	void set_params(param_type _params);
 
+	/** @param _cache the cache of the objective values of the subsets of the
+	 * features of the covariance matrix (nullptr disables it). It's shared by the
+	 * phases of the algorithm and may also be shared by runs on the same
+	 * covariance matrix with the same parameters
+	 */
+	void set_cache(SubsetCache<T>* _cache);
+
+	/** warm-starts the algorithm with the result of the first forward regression
+	 * phase, which is then not run again. It's meant for sweeps over the number
+	 * of target features, where the results of ForwardRegression for all of them
+	 * come from a single ForwardRegression::run_path() call
+	 *
+	 * @param _fr_result the function value and selected feature indices of
+	 * FRAlgo on the whole covariance matrix for target_feats features
+	 */
+	void set_fr_result(const std::pair<T,std::vector<index_t>>& _fr_result);
+
 private:
 	/** parameters */
 	param_type params;
 
 	/** real valued dense covariance matrix */
-	const Eigen::Ref<const Matrix<float64_t>> cov;
+	const Eigen::Ref<const Matrix<T>> cov;
 
 	/** number of target features */
 	index_t target_feats;
+
+	/** the cache of the objective values */
+	SubsetCache<T>* cache;
+
+	/** whether the result of the first forward regression phase is given */
+	bool has_fr_result;
+
+	/** the given result of the first forward regression phase */
+	std::pair<T,std::vector<index_t>> fr_result;
 };
 
 }
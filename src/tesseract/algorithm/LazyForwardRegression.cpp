@@ -0,0 +1,185 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/algorithm/LazyForwardRegression.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <vector>
+#include <queue>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T>
+LazyForwardRegressionParam<Regularizer, T>::LazyForwardRegressionParam()
+: eta(ComputeFunction<Regularizer,T>::default_eta)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+LazyForwardRegressionParam<Regularizer, T>::LazyForwardRegressionParam(T _eta,
+		LazyForwardRegressionParam<Regularizer,T>::reg_param_type reg_params)
+: eta(_eta), regularizer_params(reg_params)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+LazyForwardRegression<Regularizer,T>::LazyForwardRegression(const Eigen::Ref<const Matrix<T>>& _cov,
+		index_t _target_feats)
+: cov(_cov), target_feats(_target_feats), num_evaluations(0), num_skipped(0)
+{
+	logger.write(MemDebug, "In %s\n", __PRETTY_FUNCTION__);
+	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
+	logger.write(MemDebug, "cov.rows = %u!\n", cov.rows());
+	logger.write(MemDebug, "cov.cols = %u!\n", cov.cols());
+	logger.write(MemDebug, "target features = %u!\n", target_feats);
+}
+
+template <template <class> class Regularizer, typename T>
+LazyForwardRegression<Regularizer,T>::~LazyForwardRegression()
+{
+	logger.write(MemDebug, "%s Dying\n", __PRETTY_FUNCTION__);
+}
+
+template <template <class> class Regularizer, typename T>
+std::pair<T,std::vector<index_t>> LazyForwardRegression<Regularizer,T>::run()
+{
+	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
+
+	// number of feats
+	index_t N = cov.cols() - 1;
+	logger.write(Debug, "total feats = %u!\n", N);
+
+	IncrementalComputeFunction<Regularizer, T> g(cov, target_feats);
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+	typename IncrementalComputeFunction<Regularizer, T>::Workspace work;
+
+	// heap entry - the marginal gain of a feature and the round in which it
+	// was computed. the gains are ordered descending and ties are broken
+	// towards the smallest index, as in ForwardRegression
+	struct Entry
+	{
+		T gain;
+		index_t j;
+		index_t round;
+
+		bool operator<(const Entry& other) const
+		{
+			return gain < other.gain || (gain == other.gain && j > other.j);
+		}
+	};
+
+	num_evaluations = 0;
+	num_skipped = 0;
+
+	// first round evaluates every feature since g of the empty set is 0
+	std::priority_queue<Entry> heap;
+	if (target_feats > 0)
+	{
+		for (index_t j = 0; j < N; ++j)
+		{
+			heap.push(Entry{g(j, work), j, 0});
+		}
+		num_evaluations += N;
+	}
+
+	// final function value
+	T maxval = 0;
+
+	for (index_t i = 0; i < target_feats; ++i)
+	{
+		// re-evaluate the stale top of the heap until a fresh gain is on top
+		while (!heap.empty() && heap.top().round != i)
+		{
+			Entry top = heap.top();
+			heap.pop();
+
+			top.gain = g(top.j, work) - maxval;
+			top.round = i;
+			heap.push(top);
+			num_evaluations++;
+		}
+
+		// make sure that we added something
+		assert(!heap.empty() && maxval + heap.top().gain > 0);
+
+		index_t argmax = heap.top().j;
+		heap.pop();
+
+		// update the working set
+		g.add(argmax);
+		maxval = g.get_value();
+
+		logger.write(Debug, "i = %u, maxval = %f, argmax = %u!\n", i, maxval, argmax);
+
+		// forward regression evaluates all N-i remaining features in round i
+		num_skipped += N - i;
+	}
+
+	num_skipped -= num_evaluations;
+	logger.write(Debug, "function evaluations = %u, skipped = %u!\n",
+			num_evaluations, num_skipped);
+
+	// return vector - indices of selected features
+	std::vector<index_t> inds = g.get_inds();
+
+	return std::make_pair(maxval, inds);
+}
+
+template <template <class> class Regularizer, typename T>
+void LazyForwardRegression<Regularizer,T>::set_params(LazyForwardRegression<Regularizer,T>::param_type _params)
+{
+	params = _params;
+}
+
+template <template <class> class Regularizer, typename T>
+index_t LazyForwardRegression<Regularizer,T>::get_num_evaluations() const
+{
+	return num_evaluations;
+}
+
+template <template <class> class Regularizer, typename T>
+index_t LazyForwardRegression<Regularizer,T>::get_num_skipped() const
+{
+	return num_skipped;
+}
+
+template class LazyForwardRegressionParam<DummyRegularizer, float64_t>;
+template class LazyForwardRegressionParam<SmoothedDifferentialEntropy, float64_t>;
+template class LazyForwardRegressionParam<SpectralVariance, float64_t>;
+template class LazyForwardRegression<DummyRegularizer, float64_t>;
+template class LazyForwardRegression<SmoothedDifferentialEntropy, float64_t>;
+template class LazyForwardRegression<SpectralVariance, float64_t>;
+
+template class LazyForwardRegressionParam<DummyRegularizer, float32_t>;
+template class LazyForwardRegressionParam<SmoothedDifferentialEntropy, float32_t>;
+template class LazyForwardRegressionParam<SpectralVariance, float32_t>;
+template class LazyForwardRegression<DummyRegularizer, float32_t>;
+template class LazyForwardRegression<SmoothedDifferentialEntropy, float32_t>;
+template class LazyForwardRegression<SpectralVariance, float32_t>;
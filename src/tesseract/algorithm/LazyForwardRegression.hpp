@@ -0,0 +1,110 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef LAZY_FORWARD_REGRESSION_H__
+#define LAZY_FORWARD_REGRESSION_H__
+
+#include <tesseract/base/types.h>
+
+namespace tesseract
+{
+
+/** @brief struct for parameters used in lazy forward-regression */
+template <template <class> class Regularizer, typename T>
+struct LazyForwardRegressionParam
+{
+	/** regularizer param type */
+	typedef typename Regularizer<T>::param_type reg_param_type;
+
+	/** default constructor */
+	LazyForwardRegressionParam();
+
+	/** constructor */
+	LazyForwardRegressionParam(T _eta, reg_param_type reg_params);
+
+	/** regularization constant \f$\eta > 0\f$ */
+	T eta;
+
+	/** regularizer params */
+	reg_param_type regularizer_params;
+};
+
+/** @brief class LazyForwardRegression for the lazy greedy variant of forward
+ * regression. The marginal gains \f$g(S\cup\{j\})-g(S)\f$ computed in the
+ * earlier rounds are kept in a max-heap as upper bounds of the current ones
+ * and only the candidates on top of the heap are re-evaluated. For a submodular
+ * objective it selects the same features as ForwardRegression, otherwise the
+ * bounds are heuristic.
+ */
+template <template <class> class Regularizer, typename T>
+class LazyForwardRegression
+{
+public:
+	/** parameter type */
+	typedef LazyForwardRegressionParam<Regularizer, T> param_type;
+
+	/** constructor
+	 * @param _cov the covariance matrix
+	 * @param _target_feats number of target features (default value is 0)
+	 */
+	LazyForwardRegression(const Eigen::Ref<const Matrix<T>>& _cov, index_t _target_feats = 0);
+
+	/** destructor */
+	~LazyForwardRegression();
+
+	/** @return a pair of the function value and selected feature indices */
+	std::pair<T,std::vector<index_t>> run();
+
+	/** @param param the parameter type */
+	void set_params(param_type _params);
+
+	/** @return the number of function evaluations in the last run */
+	index_t get_num_evaluations() const;
+
+	/** @return the number of function evaluations saved in the last run
+	 * compared to ForwardRegression
+	 */
+	index_t get_num_skipped() const;
+
+private:
+	/** parameters */
+	param_type params;
+
+	/** real valued dense covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** number of target features */
+	index_t target_feats;
+
+	/** number of function evaluations in the last run */
+	index_t num_evaluations;
+
+	/** number of function evaluations saved in the last run */
+	index_t num_skipped;
+};
+
+}
+
+#endif // LAZY_FORWARD_REGRESSION_H__
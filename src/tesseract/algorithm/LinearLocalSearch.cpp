@@ -25,13 +25,16 @@
 #include <tesseract/base/init.hpp>
 #include <tesseract/algorithm/LinearLocalSearch.hpp>
 #include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/SubsetCache.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
-#include <tesseract/features/Features.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
+#include <tesseract/regularizer/IncrementalRegularizer.hpp>
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
 
 using namespace tesseract;
@@ -56,7 +59,7 @@ LinearLocalSearchParam<Regularizer, T>::LinearLocalSearchParam(T _eta,reg_param_
 
 template <template <class> class Regularizer, typename T>
 LinearLocalSearch<Regularizer, T>::LinearLocalSearch(const Eigen::Ref<const Matrix<T>>& _cov)
-: cov(_cov), global_value(0)
+: cov(_cov), global_value(0), cache(nullptr), index_map(nullptr)
 {
 }
 
@@ -73,19 +76,6 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 	// number of total features
 	index_t n = cov.cols() - 1;
 
-	// create the regularizer function
-	Regularizer<T> f;
-	f.set_params(params.regularizer_params);
-
-	// computing the initial values
-	T f_Xi = 0;
-	T f_Yi = f(cov.topLeftCorner(n, n));
-
-	logger.write(Debug, "f(null) = %f, f(all) = %f\n", f_Xi, f_Yi);
-
-	// make sure the function is non-negative
-	assert(f_Yi >= 0.0);
-
 	// index sets
 	std::vector<index_t> inds;
 	inds.reserve(n);
@@ -93,19 +83,6 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 	std::vector<bool> removed(n);
 	std::fill(removed.begin(), removed.end(), false);
 
-	// flag for avoiding covariance matrix copying if indices are either added or
-	// removed consecutively
-	bool is_consecutive = true;
-
-	// functor to compute if all of the features are being added to X or being
-	// removed from Y to check whether the operation is consecutive
-	std::function<bool(std::vector<bool>&, index_t i)> all_same =
-		[](std::vector<bool>& v, index_t i)
-	{
-		return std::all_of(v.begin(), v.begin()+i+1, [](bool s){ return s; }) ||
-			std::all_of(v.begin(), v.begin()+i+1, [](bool s){ return !s; });
-	};
-
 	// functor to compute unremoved indices from the removed list
 	std::function<void(std::vector<bool>&, std::vector<index_t>&)> find_unremoved_inds =
 		[](std::vector<bool>& removed, std::vector<index_t>& inds)
@@ -117,69 +94,63 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 		}
 	};
 
-	// main loop of linear time local search
-	for (index_t i = 0; i < n; ++i)
+	// the regularizer on X grows by one feature at a time while the one on Y,
+	// which starts from all the features, shrinks by one, so that each step
+	// costs one extension and one removal.
+	// X holds inds in the order of addition and Y holds inds followed by i..n-1
+	IncrementalRegularizer<Regularizer, T> f_X(n);
+	IncrementalRegularizer<Regularizer, T> f_Y(n);
+	f_X.set_params(params.regularizer_params);
+	f_Y.set_params(params.regularizer_params);
+
+	Vector<T> cross(n);
+	for (index_t j = 0; j < n; ++j)
 	{
-		// current function values
-		// current_fX is f(X_{i+1}) which is f(X_{i-1}\cup \{x_i\})
-		// current_fY is f(Y_{i+1}) which is f(Y_{i-1}\setminus \{x_i\})
-		T current_fX = 0;
-		T current_fY = 0;
-
-		// if added or removed indices are consecutive, we don't need to copy the
-		// covariance matrix. we can just specify a contiguous block of it and
-		// save time required by copying
-		if (is_consecutive)
-		{
-			logger.write(Debug, "i = %d, consecutive, no copy required!\n", i);
+		cross.head(j) = cov.col(j).head(j);
+		f_Y.add(cross.head(j), cov(j, j));
+	}
 
-			// for consecutive case, submatrix of cov(0,0) to cov(i,i) will be c_S
-			current_fX = f(cov.topLeftCorner(i+1,i+1));
+	// computing the initial values, f(all) comes from the factorization of Y
+	T f_Xi = 0;
+	T f_Yi = f_Y.value();
 
-			if (logger.get_loglevel() >= MemDebug)
-			{
-				logger.print_matrix(cov.topLeftCorner(i+1,i+1));
-			}
+	logger.write(Debug, "f(null) = %f, f(all) = %f\n", f_Xi, f_Yi);
 
-			// similarly, submatrix of cov(i+1,i+1) to cov(n-1,n-1) will be c_(U-S)
-			current_fY = f(cov.topLeftCorner(n,n).bottomRightCorner(n-i-1,n-i-1));
+	// make sure the function is non-negative
+	assert(f_Yi >= 0.0);
 
-			if (logger.get_loglevel() >= MemDebug)
-			{
-				logger.print_matrix(cov.topLeftCorner(n,n).bottomRightCorner(n-i-1,n-i-1));
-			}
+	// functor to gather the column of C_Y of feature i, which is at position
+	// inds.size() of Y
+	std::function<void(index_t)> gather_Y = [&](index_t i)
+	{
+		index_t pos = inds.size();
+		for (index_t r = 0; r < pos; ++r)
+		{
+			cross[r] = cov(inds[r], i);
 		}
-		else
+		cross.segment(pos, n - i) = cov.col(i).segment(i, n - i);
+	};
+
+	// functor to gather the cross covariance of feature i with X
+	std::function<void(index_t)> gather_X = [&](index_t i)
+	{
+		for (index_t r = 0; r < inds.size(); ++r)
 		{
-			// we have to copy the covariance matrix for the indices
-			{
-				std::vector<index_t> cur_inds(inds);
-				cur_inds.push_back(i);
-
-				Matrix<T> c_X = Features<T>::copy_cov(cov, cur_inds);
-				current_fX = f(c_X);
-
-				if (logger.get_loglevel() >= MemDebug)
-				{
-					logger.print_matrix(c_X);
-				}
-			}
-
-			{
-				std::vector<bool> cur_removed(removed);
-				cur_removed[i] = true;
-				std::vector<index_t> unremoved_inds;
-				find_unremoved_inds(cur_removed, unremoved_inds);
-
-				Matrix<T> c_Y = Features<T>::copy_cov(cov, unremoved_inds);
-				current_fY = f(c_Y);
-
-				if (logger.get_loglevel() >= MemDebug)
-				{
-					logger.print_matrix(c_Y);
-				}
-			}
+			cross[r] = cov(inds[r], i);
 		}
+	};
+
+	// main loop of linear time local search
+	for (index_t i = 0; i < n; ++i)
+	{
+		// current function values
+		// current_fX is f(X_{i+1}) which is f(X_{i-1}\cup \{x_i\})
+		// current_fY is f(Y_{i+1}) which is f(Y_{i-1}\setminus \{x_i\})
+		// both come from the factorizations. the column of C_Y of x_i starts
+		// with its cross covariance with X, which the extension overwrites
+		gather_Y(i);
+		T current_fY = f_Y.removal(inds.size(), cross.head(inds.size() + n - i));
+		T current_fX = f_X.extension(cross.head(inds.size()), cov(i, i));
 
 		logger.write(Debug,"%d: f(Xi) = %f, f(Yi) = %f\n", i, current_fX, current_fY);
 
@@ -193,19 +164,20 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 		if (a_i >= b_i && a_i > 0.0)
 		{
 			// add i-th element to X, keep Y the same
+			gather_X(i);
+			f_X.add(cross.head(inds.size()), cov(i, i));
 			inds.push_back(i);
 			logger.write(Debug, "%d is added to Xn!\n", i);
 		}
 		else
 		{
 			// keep X same, remove i-th element from Y
+			gather_Y(i);
+			f_Y.remove(inds.size(), cross.head(inds.size() + n - i));
 			removed[i] = true;
 			logger.write(Debug, "%d is removed from Yn!\n", i);
 		}
 
-		// check if addition or removal is still consecutive
-		is_consecutive = all_same(removed, i);
-
 		// update the function values
 		f_Xi = current_fX;
 		f_Yi = current_fY;
@@ -238,7 +210,7 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 	// if none of the features were added or all of the features were added
 	// then save some computation since we don't need to evaluate g at all
 	// because LS was useless - returning 0 value instead
-	if (is_consecutive)
+	if (inds.empty() || inds.size() == n)
 	{
 		return std::make_pair(0.0, inds);
 	}
@@ -247,6 +219,7 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 	ComputeFunction<Regularizer, T> g;
 	g.set_eta(params.eta);
 	g.set_reg_params(params.regularizer_params);
+	g.set_cache(cache, index_map);
 
 	// reference of the indices that will be returned
 	std::vector<index_t>& ret_inds = inds;
@@ -255,8 +228,7 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 	inds.push_back(n);
 
 	// on S
-	Matrix<T> c_s = Features<T>::copy_cov(cov, inds);
-	T retval = g(c_s);
+	T retval = g(IndexedCovariance<T>(cov, inds));
 
 	// on U \ S and U
 	std::vector<index_t> rest_inds;
@@ -275,8 +247,7 @@ std::pair<T,std::vector<index_t>> LinearLocalSearch<Regularizer, T>::run()
 
 	// make sure that the last row/col is also included since it contains the b_S part
 	rest_inds.push_back(n);
-	c_s = Features<T>::copy_cov(cov, rest_inds);
-	T g_UminusS = g(c_s);
+	T g_UminusS = g(IndexedCovariance<T>(cov, rest_inds));
 
 	if (g_UminusS > retval)
 	{
@@ -320,9 +291,24 @@ void LinearLocalSearch<Regularizer, T>::set_global_value(T value)
 	global_value = value;
 }
 
+template <template <class> class Regularizer, typename T>
+void LinearLocalSearch<Regularizer, T>::set_cache(SubsetCache<T>* _cache,
+		const std::vector<index_t>* _index_map)
+{
+	cache = _cache;
+	index_map = _index_map;
+}
+
 template class LinearLocalSearchParam<DummyRegularizer, float64_t>;
 template class LinearLocalSearchParam<SmoothedDifferentialEntropy, float64_t>;
 template class LinearLocalSearchParam<SpectralVariance, float64_t>;
 template class LinearLocalSearch<DummyRegularizer, float64_t>;
 template class LinearLocalSearch<SmoothedDifferentialEntropy, float64_t>;
 template class LinearLocalSearch<SpectralVariance, float64_t>;
+
+template class LinearLocalSearchParam<DummyRegularizer, float32_t>;
+template class LinearLocalSearchParam<SmoothedDifferentialEntropy, float32_t>;
+template class LinearLocalSearchParam<SpectralVariance, float32_t>;
+template class LinearLocalSearch<DummyRegularizer, float32_t>;
+template class LinearLocalSearch<SmoothedDifferentialEntropy, float32_t>;
+template class LinearLocalSearch<SpectralVariance, float32_t>;
@@ -23,49 +23,58 @@
  */
 
 #include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
 #include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/SubsetCache.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
-#include <tesseract/features/Features.hpp>
+#include <tesseract/regularizer/IncrementalRegularizer.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <numeric>
 #include <iostream>
+#include <atomic>
 
 using namespace tesseract;
 
 template <template <class> class Regularizer, typename T>
 LocalSearchParam<Regularizer, T>::LocalSearchParam()
 :eta(ComputeFunction<Regularizer,T>::default_eta),
-	eps(LocalSearchParam<Regularizer,T>::default_eps)
+	eps(LocalSearchParam<Regularizer,T>::default_eps), num_threads(1),
+	delete_moves(false), swap_moves(false)
 {
 }
 
 template <template <class> class Regularizer, typename T>
 LocalSearchParam<Regularizer, T>::LocalSearchParam(T _eta)
-:eta(_eta), eps(LocalSearchParam<Regularizer,T>::default_eps)
+:eta(_eta), eps(LocalSearchParam<Regularizer,T>::default_eps), num_threads(1),
+	delete_moves(false), swap_moves(false)
 {
 }
 
 template <template <class> class Regularizer, typename T>
 LocalSearchParam<Regularizer, T>::LocalSearchParam(T _eta,reg_param_type reg_params)
 :eta(_eta), eps(LocalSearchParam<Regularizer,T>::default_eps),
-	regularizer_params(reg_params)
+	regularizer_params(reg_params), num_threads(1),
+	delete_moves(false), swap_moves(false)
 {
 }
 
 template <template <class> class Regularizer, typename T>
 LocalSearchParam<Regularizer, T>::LocalSearchParam(T _eta, T _eps,
 		LocalSearchParam<Regularizer,T>::reg_param_type reg_params)
-: eta(_eta), eps(_eps), regularizer_params(reg_params)
+: eta(_eta), eps(_eps), regularizer_params(reg_params), num_threads(1),
+	delete_moves(false), swap_moves(false)
 {
 }
 
 template <template <class> class Regularizer, typename T>
 LocalSearch<Regularizer, T>::LocalSearch(const Eigen::Ref<const Matrix<T>>& _cov)
-: cov(_cov), global_value(0)
+: cov(_cov), global_value(0), cache(nullptr), index_map(nullptr)
 {
 }
 
@@ -84,25 +93,47 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 	T maxval = 0;
 	index_t argmax = -1;
 
-	// create the regularizer function
-	Regularizer<T> f;
+	// create the regularizer function on the working set, which evaluates
+	// the candidate extensions from the cross covariances
+	IncrementalRegularizer<Regularizer, T> f(n);
 	f.set_params(params.regularizer_params);
 
+	// the candidates are evaluated in parallel on contiguous chunks
+	ThreadPool pool(params.num_threads);
+	index_t num_chunks = pool.get_num_threads();
+	std::vector<std::pair<T,index_t>> chunk_max(num_chunks);
+
 	// computing the argmax part
-	for (index_t j = 0; j < n; ++j)
+	pool.parallel_for(n, [&](index_t t, index_t begin, index_t end)
 	{
-		std::vector<index_t> inds;
-		inds.push_back(j);
+		T local_maxval = 0;
+		index_t local_argmax = -1;
+		Vector<T> cross(1);
+
+		for (index_t j = begin; j < end; ++j)
+		{
+			// evaluate the function on the regressors
+			T val = f.extension(cross, cov(j, j));
+
+			// update running max and argmax of the chunk
+			if (val > local_maxval)
+			{
+				local_maxval = val;
+				local_argmax = j;
+			}
+		}
 
-		// evaluate the function on the regressors
-		Matrix<T> c_s = Features<T>::copy_cov(cov, inds);
-		T val = f(c_s);
+		chunk_max[t] = std::make_pair(local_maxval, local_argmax);
+	});
 
-		// update running max and argmax
-		if (val > maxval)
+	// reduce in the order of the chunks so that ties are broken towards the
+	// smallest index, exactly as in a serial run
+	for (index_t t = 0; t < num_chunks; ++t)
+	{
+		if (chunk_max[t].first > maxval)
 		{
-			maxval = val;
-			argmax = j;
+			maxval = chunk_max[t].first;
+			argmax = chunk_max[t].second;
 		}
 	}
 
@@ -115,13 +146,20 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 	// return vector - indices of selected features
 	std::vector<index_t> inds;
 
+	// indices of selected features in the order in which they were added to f
+	std::vector<index_t> order;
+	order.reserve(n);
+
 	// status vector to avoid overchecking
 	std::vector<bool> selected(n);
 	std::fill(selected.begin(), selected.end(), false);
 
 	// update the working set
 	inds.push_back(argmax);
+	order.push_back(argmax);
 	selected[argmax] = true;
+	Vector<T> cross(n);
+	f.add(cross, cov(argmax, argmax));
 
 	// fancy way of handling the end condition of the main loop
 	std::function<bool(bool)> end_cond = [n, inds](bool exists)
@@ -144,34 +182,148 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 		exists = false;
 		T threshold = limit * maxval;
 
-		// loop through the features
-		for (index_t j = 0; j < n && !exists; ++j)
+		// loop through the features, the first feature (in index order) which
+		// increases f enough is taken. each chunk stops at its first such
+		// feature or as soon as a smaller one has been found by another chunk
+		std::atomic<index_t> first_found(n);
+		std::vector<std::pair<T,index_t>> chunk_found(num_chunks);
+
+		pool.parallel_for(n, [&](index_t t, index_t begin, index_t end)
 		{
-			// make sure to check only those that are not already added
-			if (!selected[j])
-			{
-				// need a local copy of the indices
-				std::vector<index_t> cur_inds(inds);
-				cur_inds.push_back(j);
+			chunk_found[t] = std::make_pair(0, n);
 
-				// evaluate the function on the regressors
-				Matrix<T> c_s = Features<T>::copy_cov(cov, cur_inds);
-				T val = f(c_s);
+			// scratch memory for the cross covariances of the chunk
+			Vector<T> cur_cross(order.size() + 1);
 
-				// update running max and argmax
-				if (exists = val >= threshold)
+			for (index_t j = begin; j < end && j < first_found.load(); ++j)
+			{
+				// make sure to check only those that are not already added
+				if (!selected[j])
 				{
-					maxval = val;
-					argmax = j;
+					for (index_t i = 0; i < order.size(); ++i)
+					{
+						cur_cross[i] = cov(order[i], j);
+					}
+
+					// evaluate the function on the regressors
+					T val = f.extension(cur_cross, cov(j, j));
+
+					if (val >= threshold)
+					{
+						chunk_found[t] = std::make_pair(val, j);
+
+						// keep the minimum index found so far
+						index_t found = first_found.load();
+						while (j < found && !first_found.compare_exchange_weak(found, j));
+						break;
+					}
 				}
 			}
+		});
+
+		// the first chunk which found a feature has the smallest index
+		for (index_t t = 0; t < num_chunks && !exists; ++t)
+		{
+			// update running max and argmax
+			exists = chunk_found[t].second < n;
+			if (exists)
+			{
+				maxval = chunk_found[t].first;
+				argmax = chunk_found[t].second;
+			}
 		}
 
-		// update the working set
+		// update the working set, keeping the indices sorted
 		if (exists)
 		{
-			inds.push_back(argmax);
+			inds.insert(std::lower_bound(inds.begin(), inds.end(), argmax), argmax);
 			selected[argmax] = true;
+
+			for (index_t i = 0; i < order.size(); ++i)
+			{
+				cross[i] = cov(order[i], argmax);
+			}
+			f.add(cross, cov(argmax, argmax));
+			order.push_back(argmax);
+		}
+
+		// otherwise the first feature (in the order of addition) whose removal
+		// increases f enough is removed
+		if (!exists && params.delete_moves && order.size() > 1)
+		{
+			for (index_t p = 0; p < order.size() && !exists; ++p)
+			{
+				for (index_t i = 0; i < order.size(); ++i)
+				{
+					cross[i] = cov(order[i], order[p]);
+				}
+
+				// f has to increase strictly, otherwise the moves could cycle
+				T val = f.removal(p, cross.head(order.size()));
+				exists = val >= threshold && val > maxval;
+				if (exists)
+				{
+					maxval = val;
+					f.remove(p, cross.head(order.size()));
+
+					inds.erase(std::lower_bound(inds.begin(), inds.end(), order[p]));
+					selected[order[p]] = false;
+					order.erase(order.begin() + p);
+				}
+			}
+		}
+
+		// otherwise the first pair of a selected feature (in the order of
+		// addition) and a feature (in index order) exchanging which increases f
+		// enough is exchanged. the removal is done once per selected feature on
+		// a copy, so that every exchange costs one extension
+		if (!exists && params.swap_moves && order.size() < n)
+		{
+			for (index_t p = 0; p < order.size() && !exists; ++p)
+			{
+				for (index_t i = 0; i < order.size(); ++i)
+				{
+					cross[i] = cov(order[i], order[p]);
+				}
+
+				IncrementalRegularizer<Regularizer, T> f_p(f);
+				f_p.remove(p, cross.head(order.size()));
+
+				std::vector<index_t> order_p(order);
+				order_p.erase(order_p.begin() + p);
+
+				for (index_t j = 0; j < n && !exists; ++j)
+				{
+					if (!selected[j])
+					{
+						for (index_t i = 0; i < order_p.size(); ++i)
+						{
+							cross[i] = cov(order_p[i], j);
+						}
+
+						T val = f_p.extension(cross, cov(j, j));
+						exists = val >= threshold && val > maxval;
+						if (exists)
+						{
+							maxval = val;
+
+							for (index_t i = 0; i < order_p.size(); ++i)
+							{
+								cross[i] = cov(order_p[i], j);
+							}
+							f_p.add(cross, cov(j, j));
+							f = f_p;
+
+							inds.erase(std::lower_bound(inds.begin(), inds.end(), order[p]));
+							inds.insert(std::lower_bound(inds.begin(), inds.end(), j), j);
+							selected[order[p]] = false;
+							selected[j] = true;
+							order_p.push_back(j);
+							order = order_p;
+						}
+					}
+				}
+			}
 		}
 
 	} while (end_cond(exists));
@@ -186,6 +338,7 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 	ComputeFunction<Regularizer, T> g;
 	g.set_eta(params.eta);
 	g.set_reg_params(params.regularizer_params);
+	g.set_cache(cache, index_map);
 
 	// reference of the indices that will be returned
 	std::vector<index_t>& ret_inds = inds;
@@ -194,8 +347,7 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 	inds.push_back(n);
 
 	// on S
-	Matrix<T> c_s = Features<T>::copy_cov(cov, inds);
-	T retval = g(c_s);
+	T retval = g(IndexedCovariance<T>(cov, inds));
 
 	// on U\S and U
 	std::vector<index_t> rest_inds;
@@ -215,8 +367,7 @@ std::pair<T,std::vector<index_t>> LocalSearch<Regularizer, T>::run()
 
 		// make sure that the last row/col is also included since it contains the b_S part
 		rest_inds.push_back(n);
-		c_s = Features<T>::copy_cov(cov, rest_inds);
-		T g_UminusS = g(c_s);
+		T g_UminusS = g(IndexedCovariance<T>(cov, rest_inds));
 
 		if (g_UminusS > retval)
 		{
@@ -260,9 +411,24 @@ void LocalSearch<Regularizer, T>::set_global_value(T value)
 	global_value = value;
 }
 
+template <template <class> class Regularizer, typename T>
+void LocalSearch<Regularizer, T>::set_cache(SubsetCache<T>* _cache,
+		const std::vector<index_t>* _index_map)
+{
+	cache = _cache;
+	index_map = _index_map;
+}
+
 template class LocalSearchParam<DummyRegularizer, float64_t>;
 template class LocalSearchParam<SmoothedDifferentialEntropy, float64_t>;
 template class LocalSearchParam<SpectralVariance, float64_t>;
 template class LocalSearch<DummyRegularizer, float64_t>;
 template class LocalSearch<SmoothedDifferentialEntropy, float64_t>;
 template class LocalSearch<SpectralVariance, float64_t>;
+
+template class LocalSearchParam<DummyRegularizer, float32_t>;
+template class LocalSearchParam<SmoothedDifferentialEntropy, float32_t>;
+template class LocalSearchParam<SpectralVariance, float32_t>;
+template class LocalSearch<DummyRegularizer, float32_t>;
+template class LocalSearch<SmoothedDifferentialEntropy, float32_t>;
+template class LocalSearch<SpectralVariance, float32_t>;
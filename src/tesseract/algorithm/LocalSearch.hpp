@@ -30,6 +30,8 @@
 namespace tesseract
 {
 
+template <typename T> class SubsetCache;
+
 /** @brief class LocalSearchParam for storing local search parameters */
 template <template <class> class Regularizer, typename T>
 struct LocalSearchParam
@@ -58,6 +60,17 @@ struct LocalSearchParam
 	/** regularizer params */
 	reg_param_type regularizer_params;
 
+	/** number of threads for evaluating the candidates (0 uses all cores) */
+	index_t num_threads;
+
+	/** whether removing a feature is tried when no feature can be added */
+	bool delete_moves;
+
+	/** whether exchanging a selected feature for another one is tried when no
+	 * feature can be added or removed
+	 */
+	bool swap_moves;
+
 	/** default epsilon value */
 	static constexpr T default_eps = static_cast<T>(22);
 };
@@ -92,15 +105,28 @@ public:
 	 */
 	void set_global_value(T value);
 
+	/** @param _cache the cache of the objective values of the subsets, see
+	 * ComputeFunction::set_cache()
+	 * @param _index_map maps the indices of the covariance matrix to the ones of
+	 * the cache keys (nullptr if the indices are the same)
+	 */
+	void set_cache(SubsetCache<T>* _cache, const std::vector<index_t>* _index_map = nullptr);
+
 private:
 	/** real valued dense covariance matrix */
-	const Eigen::Ref<const Matrix<float64_t>> cov;
+	const Eigen::Ref<const Matrix<T>> cov;
 
 	/** the algorithm params */
 	param_type params;
 
 	/** the global value g(U) */
 	T global_value;
+
+	/** the cache of the objective values */
+	SubsetCache<T>* cache;
+
+	/** the map from the indices to the ones of the cache keys */
+	const std::vector<index_t>* index_map;
 };
 
 }
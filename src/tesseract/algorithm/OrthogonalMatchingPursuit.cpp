@@ -0,0 +1,161 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/algorithm/OrthogonalMatchingPursuit.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
+#include <vector>
+#include <limits>
+#include <cmath>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T>
+OrthogonalMatchingPursuitParam<Regularizer, T>::OrthogonalMatchingPursuitParam()
+: eta(ComputeFunction<Regularizer,T>::default_eta)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+OrthogonalMatchingPursuitParam<Regularizer, T>::OrthogonalMatchingPursuitParam(T _eta,
+		OrthogonalMatchingPursuitParam<Regularizer,T>::reg_param_type reg_params)
+: eta(_eta), regularizer_params(reg_params)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+OrthogonalMatchingPursuit<Regularizer,T>::OrthogonalMatchingPursuit(const Eigen::Ref<const Matrix<T>>& _cov,
+		index_t _target_feats)
+: cov(_cov), target_feats(_target_feats)
+{
+	logger.write(MemDebug, "In %s\n", __PRETTY_FUNCTION__);
+	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
+	logger.write(MemDebug, "cov.rows = %u!\n", cov.rows());
+	logger.write(MemDebug, "cov.cols = %u!\n", cov.cols());
+	logger.write(MemDebug, "target features = %u!\n", target_feats);
+}
+
+template <template <class> class Regularizer, typename T>
+OrthogonalMatchingPursuit<Regularizer,T>::~OrthogonalMatchingPursuit()
+{
+	logger.write(MemDebug, "%s Dying\n", __PRETTY_FUNCTION__);
+}
+
+template <template <class> class Regularizer, typename T>
+std::pair<T,std::vector<index_t>> OrthogonalMatchingPursuit<Regularizer,T>::run()
+{
+	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
+
+	// number of feats
+	index_t N = cov.cols() - 1;
+	logger.write(Debug, "total feats = %u!\n", N);
+
+	// covariances of all the features (and b in the last row) with the
+	// orthonormal directions q_1, ..., q_k spanning the selected features
+	Matrix<T> Q(N + 1, target_feats);
+
+	// correlation of the features with the residual b - P_S b
+	Vector<T> residual_corr = cov.col(N);
+
+	// status vector to avoid overchecking
+	std::vector<bool> selected(N);
+	std::fill(selected.begin(), selected.end(), false);
+
+	// return vector - indices of selected features
+	std::vector<index_t> inds;
+
+	for (index_t i = 0; i < target_feats; ++i)
+	{
+		// pick the feature most correlated with the residual, skipping those
+		// which are (numerically) in the span of the selected ones
+		T maxval = 0;
+		index_t argmax = -1;
+		for (index_t j = 0; j < N; ++j)
+		{
+			if (!selected[j] && std::abs(residual_corr[j]) > maxval)
+			{
+				// squared norm of the part of x_j orthogonal to the selection
+				T d_sq = cov(j, j) - Q.row(j).head(i).squaredNorm();
+				if (d_sq > std::numeric_limits<T>::epsilon() * cov(j, j))
+				{
+					maxval = std::abs(residual_corr[j]);
+					argmax = j;
+				}
+			}
+		}
+
+		logger.write(Debug, "i = %u, maxval = %f, argmax = %u!\n", i, maxval, argmax);
+
+		// nothing left to explain
+		if (argmax == -1)
+			break;
+
+		// Gram-Schmidt - the new direction is x_a minus its projection, whose
+		// covariances with all the columns are C_{:,a} - Q Q_{a,:}^T
+		Q.col(i) = cov.col(argmax) - Q.leftCols(i) * Q.row(argmax).head(i).transpose();
+		Q.col(i) /= sqrt(Q(argmax, i));
+
+		// the residual loses its component along the new direction
+		residual_corr -= Q(N, i) * Q.col(i);
+
+		inds.push_back(argmax);
+		selected[argmax] = true;
+	}
+
+	// compute the objective function on the selected features
+	ComputeFunction<Regularizer, T> g;
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+
+	std::vector<index_t> cov_inds(inds);
+	cov_inds.push_back(N);
+	T value = g(IndexedCovariance<T>(cov, cov_inds));
+
+	return std::make_pair(value, inds);
+}
+
+template <template <class> class Regularizer, typename T>
+void OrthogonalMatchingPursuit<Regularizer,T>::set_params(OrthogonalMatchingPursuit<Regularizer,T>::param_type _params)
+{
+	params = _params;
+}
+
+template class OrthogonalMatchingPursuitParam<DummyRegularizer, float64_t>;
+template class OrthogonalMatchingPursuitParam<SmoothedDifferentialEntropy, float64_t>;
+template class OrthogonalMatchingPursuitParam<SpectralVariance, float64_t>;
+template class OrthogonalMatchingPursuit<DummyRegularizer, float64_t>;
+template class OrthogonalMatchingPursuit<SmoothedDifferentialEntropy, float64_t>;
+template class OrthogonalMatchingPursuit<SpectralVariance, float64_t>;
+
+template class OrthogonalMatchingPursuitParam<DummyRegularizer, float32_t>;
+template class OrthogonalMatchingPursuitParam<SmoothedDifferentialEntropy, float32_t>;
+template class OrthogonalMatchingPursuitParam<SpectralVariance, float32_t>;
+template class OrthogonalMatchingPursuit<DummyRegularizer, float32_t>;
+template class OrthogonalMatchingPursuit<SmoothedDifferentialEntropy, float32_t>;
+template class OrthogonalMatchingPursuit<SpectralVariance, float32_t>;
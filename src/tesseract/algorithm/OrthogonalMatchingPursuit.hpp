@@ -0,0 +1,96 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef ORTHOGONAL_MATCHING_PURSUIT_H__
+#define ORTHOGONAL_MATCHING_PURSUIT_H__
+
+#include <tesseract/base/types.h>
+
+namespace tesseract
+{
+
+/** @brief struct for parameters used in orthogonal matching pursuit */
+template <template <class> class Regularizer, typename T>
+struct OrthogonalMatchingPursuitParam
+{
+	/** regularizer param type */
+	typedef typename Regularizer<T>::param_type reg_param_type;
+
+	/** default constructor */
+	OrthogonalMatchingPursuitParam();
+
+	/** constructor */
+	OrthogonalMatchingPursuitParam(T _eta, reg_param_type reg_params);
+
+	/** regularization constant \f$\eta > 0\f$, only used for the returned value */
+	T eta;
+
+	/** regularizer params, only used for the returned value */
+	reg_param_type regularizer_params;
+};
+
+/** @brief class OrthogonalMatchingPursuit for selecting the features by their
+ * correlation with the residual of the current fit. The selected features are
+ * orthonormalized by Gram-Schmidt on the covariance matrix, keeping the
+ * covariances of all the features with the orthonormal directions, so that
+ * each round costs \f$O(N)\f$ for the selection and \f$O(Nk)\f$ for the update.
+ * The returned value is the objective \f$g(S)\f$ of the selected features.
+ */
+template <template <class> class Regularizer, typename T>
+class OrthogonalMatchingPursuit
+{
+public:
+	/** parameter type */
+	typedef OrthogonalMatchingPursuitParam<Regularizer, T> param_type;
+
+	/** constructor
+	 * @param _cov the covariance matrix
+	 * @param _target_feats number of target features (default value is 0)
+	 */
+	OrthogonalMatchingPursuit(const Eigen::Ref<const Matrix<T>>& _cov, index_t _target_feats = 0);
+
+	/** destructor */
+	~OrthogonalMatchingPursuit();
+
+	/** @return a pair of the function value and selected feature indices */
+	std::pair<T,std::vector<index_t>> run();
+
+	/** @param param the parameter type */
+	void set_params(param_type _params);
+
+private:
+	/** parameters */
+	param_type params;
+
+	/** real valued dense covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** number of target features */
+	index_t target_feats;
+};
+
+}
+
+#endif // ORTHOGONAL_MATCHING_PURSUIT_H__
@@ -0,0 +1,184 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/algorithm/StochasticForwardRegression.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <vector>
+#include <numeric>
+#include <random>
+#include <cmath>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T>
+StochasticForwardRegressionParam<Regularizer, T>::StochasticForwardRegressionParam()
+: eta(ComputeFunction<Regularizer,T>::default_eta),
+	eps(StochasticForwardRegressionParam<Regularizer,T>::default_eps), seed(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+StochasticForwardRegressionParam<Regularizer, T>::StochasticForwardRegressionParam(T _eta,
+		StochasticForwardRegressionParam<Regularizer,T>::reg_param_type reg_params)
+: eta(_eta), eps(StochasticForwardRegressionParam<Regularizer,T>::default_eps),
+	regularizer_params(reg_params), seed(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+StochasticForwardRegressionParam<Regularizer, T>::StochasticForwardRegressionParam(T _eta, T _eps,
+		StochasticForwardRegressionParam<Regularizer,T>::reg_param_type reg_params)
+: eta(_eta), eps(_eps), regularizer_params(reg_params), seed(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+StochasticForwardRegression<Regularizer,T>::StochasticForwardRegression(const Eigen::Ref<const Matrix<T>>& _cov,
+		index_t _target_feats)
+: cov(_cov), target_feats(_target_feats)
+{
+	logger.write(MemDebug, "In %s\n", __PRETTY_FUNCTION__);
+	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
+	logger.write(MemDebug, "cov.rows = %u!\n", cov.rows());
+	logger.write(MemDebug, "cov.cols = %u!\n", cov.cols());
+	logger.write(MemDebug, "target features = %u!\n", target_feats);
+}
+
+template <template <class> class Regularizer, typename T>
+StochasticForwardRegression<Regularizer,T>::~StochasticForwardRegression()
+{
+	logger.write(MemDebug, "%s Dying\n", __PRETTY_FUNCTION__);
+}
+
+template <template <class> class Regularizer, typename T>
+std::pair<T,std::vector<index_t>> StochasticForwardRegression<Regularizer,T>::run()
+{
+	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
+
+	// number of feats
+	index_t N = cov.cols() - 1;
+	logger.write(Debug, "total feats = %u!\n", N);
+
+	IncrementalComputeFunction<Regularizer, T> g(cov, target_feats);
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+	typename IncrementalComputeFunction<Regularizer, T>::Workspace work;
+
+	// size of the candidate pool of each round
+	index_t sample_size = N;
+	if (target_feats > 0 && params.eps > 0)
+	{
+		T pool = ceil(static_cast<T>(N) / target_feats * log(1 / params.eps));
+		if (pool < N)
+			sample_size = std::max<index_t>(static_cast<index_t>(pool), 1);
+	}
+	logger.write(Debug, "sample size = %u!\n", sample_size);
+
+	// features which are not selected yet, the first ones of each round are
+	// a uniform sample without replacement (partial Fisher-Yates shuffle)
+	std::vector<index_t> rest(N);
+	std::iota(rest.begin(), rest.end(), 0);
+	std::mt19937 rng(params.seed);
+
+	// final function value
+	T maxval = 0;
+
+	for (index_t i = 0; i < target_feats; ++i)
+	{
+		index_t num_rest = rest.size();
+		index_t num_samples = std::min(sample_size, num_rest);
+
+		maxval = 0;
+		index_t argmax = -1;
+		index_t argmax_pos = -1;
+
+		for (index_t s = 0; s < num_samples; ++s)
+		{
+			if (num_samples < num_rest)
+			{
+				std::uniform_int_distribution<index_t> dist(s, num_rest - 1);
+				std::swap(rest[s], rest[dist(rng)]);
+			}
+
+			// evaluate the function on S + j
+			index_t j = rest[s];
+			T val = g(j, work);
+
+			// ties are broken towards the smallest index
+			if (val > maxval || (val == maxval && argmax != -1 && j < argmax))
+			{
+				maxval = val;
+				argmax = j;
+				argmax_pos = s;
+			}
+		}
+
+		logger.write(Debug, "i = %u, maxval = %f, argmax = %u!\n", i, maxval, argmax);
+
+		// make sure that we added something
+		assert(argmax != -1);
+
+		// update the working set
+		g.add(argmax);
+		std::swap(rest[argmax_pos], rest.back());
+		rest.pop_back();
+	}
+
+	// return vector - indices of selected features
+	std::vector<index_t> inds = g.get_inds();
+
+	return std::make_pair(maxval, inds);
+}
+
+template <template <class> class Regularizer, typename T>
+void StochasticForwardRegression<Regularizer,T>::set_params(StochasticForwardRegression<Regularizer,T>::param_type _params)
+{
+	params = _params;
+}
+
+template <template <class> class Regularizer, typename T>
+void StochasticForwardRegression<Regularizer,T>::set_seed(int32_t _seed)
+{
+	params.seed = _seed;
+}
+
+template class StochasticForwardRegressionParam<DummyRegularizer, float64_t>;
+template class StochasticForwardRegressionParam<SmoothedDifferentialEntropy, float64_t>;
+template class StochasticForwardRegressionParam<SpectralVariance, float64_t>;
+template class StochasticForwardRegression<DummyRegularizer, float64_t>;
+template class StochasticForwardRegression<SmoothedDifferentialEntropy, float64_t>;
+template class StochasticForwardRegression<SpectralVariance, float64_t>;
+
+template class StochasticForwardRegressionParam<DummyRegularizer, float32_t>;
+template class StochasticForwardRegressionParam<SmoothedDifferentialEntropy, float32_t>;
+template class StochasticForwardRegressionParam<SpectralVariance, float32_t>;
+template class StochasticForwardRegression<DummyRegularizer, float32_t>;
+template class StochasticForwardRegression<SmoothedDifferentialEntropy, float32_t>;
+template class StochasticForwardRegression<SpectralVariance, float32_t>;
@@ -0,0 +1,108 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef STOCHASTIC_FORWARD_REGRESSION_H__
+#define STOCHASTIC_FORWARD_REGRESSION_H__
+
+#include <tesseract/base/types.h>
+
+namespace tesseract
+{
+
+/** @brief struct for parameters used in stochastic forward-regression */
+template <template <class> class Regularizer, typename T>
+struct StochasticForwardRegressionParam
+{
+	/** regularizer param type */
+	typedef typename Regularizer<T>::param_type reg_param_type;
+
+	/** default constructor */
+	StochasticForwardRegressionParam();
+
+	/** constructor */
+	StochasticForwardRegressionParam(T _eta, reg_param_type reg_params);
+
+	/** constructor */
+	StochasticForwardRegressionParam(T _eta, T _eps, reg_param_type reg_params);
+
+	/** regularization constant \f$\eta > 0\f$ */
+	T eta;
+
+	/** approximation constant \f$\epsilon\f$, smaller values sample more candidates */
+	T eps;
+
+	/** regularizer params */
+	reg_param_type regularizer_params;
+
+	/** seed for sampling the candidates */
+	int32_t seed;
+
+	/** default value for eps */
+	static constexpr T default_eps = static_cast<T>(0.1);
+};
+
+/** @brief class StochasticForwardRegression for the stochastic greedy variant
+ * of forward regression. Each round evaluates only a random subset of
+ * \f$\frac{N}{k}\log\frac{1}{\epsilon}\f$ of the remaining features.
+ */
+template <template <class> class Regularizer, typename T>
+class StochasticForwardRegression
+{
+public:
+	/** parameter type */
+	typedef StochasticForwardRegressionParam<Regularizer, T> param_type;
+
+	/** constructor
+	 * @param _cov the covariance matrix
+	 * @param _target_feats number of target features (default value is 0)
+	 */
+	StochasticForwardRegression(const Eigen::Ref<const Matrix<T>>& _cov, index_t _target_feats = 0);
+
+	/** destructor */
+	~StochasticForwardRegression();
+
+	/** @return a pair of the function value and selected feature indices */
+	std::pair<T,std::vector<index_t>> run();
+
+	/** @param param the parameter type */
+	void set_params(param_type _params);
+
+	/** @param _seed for rng */
+	void set_seed(int32_t _seed);
+
+private:
+	/** parameters */
+	param_type params;
+
+	/** real valued dense covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** number of target features */
+	index_t target_feats;
+};
+
+}
+
+#endif // STOCHASTIC_FORWARD_REGRESSION_H__
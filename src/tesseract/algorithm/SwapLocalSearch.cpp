@@ -0,0 +1,272 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
+#include <tesseract/algorithm/SwapLocalSearch.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
+#include <tesseract/computation/SubsetCache.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <cmath>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T>
+SwapLocalSearchParam<Regularizer, T>::SwapLocalSearchParam()
+: eta(ComputeFunction<Regularizer,T>::default_eta), num_threads(1), max_iters(0),
+	time_budget(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+SwapLocalSearchParam<Regularizer, T>::SwapLocalSearchParam(T _eta, reg_param_type reg_params)
+: eta(_eta), regularizer_params(reg_params), num_threads(1), max_iters(0),
+	time_budget(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+SwapLocalSearch<Regularizer, T>::SwapLocalSearch(const Eigen::Ref<const Matrix<T>>& _cov,
+		index_t _target_feats)
+: cov(_cov), target_feats(_target_feats), has_initial(false), cache(nullptr),
+	index_map(nullptr)
+{
+	logger.write(MemDebug, "In %s\n", __PRETTY_FUNCTION__);
+	logger.write(MemDebug, "cov.data = %p!\n", cov.data());
+	logger.write(MemDebug, "cov.rows = %u!\n", cov.rows());
+	logger.write(MemDebug, "cov.cols = %u!\n", cov.cols());
+	logger.write(MemDebug, "target features = %u!\n", target_feats);
+}
+
+template <template <class> class Regularizer, typename T>
+SwapLocalSearch<Regularizer, T>::~SwapLocalSearch()
+{
+	logger.write(MemDebug, "%s Dying\n", __PRETTY_FUNCTION__);
+}
+
+template <template <class> class Regularizer, typename T>
+std::pair<T,std::vector<index_t>> SwapLocalSearch<Regularizer, T>::run()
+{
+	logger.write(Debug, "%s Entering!\n", __PRETTY_FUNCTION__);
+
+	// number of feats
+	index_t N = cov.cols() - 1;
+
+	// start from the given set or from the one of forward regression
+	std::vector<index_t> S;
+	if (has_initial)
+	{
+		S = initial;
+	}
+	else
+	{
+		ForwardRegression<Regularizer,T> fr(cov, target_feats);
+		typename ForwardRegression<Regularizer,T>::param_type fr_params(params.eta,
+				params.regularizer_params);
+		fr_params.num_threads = params.num_threads;
+		fr.set_params(fr_params);
+		S = fr.run().second;
+	}
+
+	index_t k = S.size();
+	logger.write(Debug, "total feats = %u, swapped set size = %u!\n", N, k);
+
+	// set the timers
+	const auto cpu0 = std::chrono::high_resolution_clock::now();
+
+	// create the compute function on S, which is downdated for each feature to
+	// swap out and then evaluates the candidates to swap in as extensions
+	IncrementalComputeFunction<Regularizer, T> g(cov, k);
+	g.set_eta(params.eta);
+	g.set_reg_params(params.regularizer_params);
+	for (index_t p = 0; p < k; ++p)
+	{
+		g.add(S[p]);
+	}
+
+	T value = g.get_value();
+	logger.write(Debug, "g(S) = %f!\n", value);
+
+	std::vector<bool> selected(N);
+	std::fill(selected.begin(), selected.end(), false);
+	for (index_t p = 0; p < k; ++p)
+	{
+		selected[S[p]] = true;
+	}
+
+	// the candidates are evaluated in parallel on contiguous chunks, each
+	// thread having its own scratch memory and running argmax
+	ThreadPool pool(params.num_threads);
+	index_t num_chunks = pool.get_num_threads();
+	std::vector<typename IncrementalComputeFunction<Regularizer, T>::Workspace> work(num_chunks);
+	std::vector<std::pair<T,index_t>> chunk_max(num_chunks);
+
+	// nothing can be swapped if all or none of the features are selected
+	index_t iter = 0;
+	while (k > 0 && k < N && (params.max_iters == 0 || iter < params.max_iters))
+	{
+		if (params.time_budget > 0)
+		{
+			const auto cpu1 = std::chrono::high_resolution_clock::now();
+			if (std::chrono::duration<float64_t>(cpu1 - cpu0).count() >= params.time_budget)
+			{
+				logger.write(Debug, "time budget exhausted after %u swaps!\n", iter);
+				break;
+			}
+		}
+
+		// a swap has to improve beyond the rounding errors of the updates,
+		// otherwise the search might cycle
+		T maxval = value + 64 * std::numeric_limits<T>::epsilon() * std::max<T>(1, std::abs(value));
+		index_t argmax_p = -1;
+		index_t argmax_j = -1;
+
+		for (index_t p = 0; p < k; ++p)
+		{
+			IncrementalComputeFunction<Regularizer, T> g_p(g);
+			g_p.remove(p);
+
+			pool.parallel_for(N, [&](index_t t, index_t begin, index_t end)
+			{
+				T local_maxval = maxval;
+				index_t local_argmax = -1;
+
+				for (index_t j = begin; j < end; ++j)
+				{
+					if (!selected[j])
+					{
+						// evaluate the function on S - p + j
+						T val = g_p(j, work[t]);
+
+						// update running max of the chunk
+						if (val > local_maxval)
+						{
+							local_maxval = val;
+							local_argmax = j;
+						}
+					}
+				}
+
+				chunk_max[t] = std::make_pair(local_maxval, local_argmax);
+			});
+
+			// reduce in the order of the chunks so that ties are broken towards
+			// the smallest index, exactly as in a serial run
+			for (index_t t = 0; t < num_chunks; ++t)
+			{
+				if (chunk_max[t].second != -1 && chunk_max[t].first > maxval)
+				{
+					maxval = chunk_max[t].first;
+					argmax_p = p;
+					argmax_j = chunk_max[t].second;
+				}
+			}
+		}
+
+		// S is a local optimum
+		if (argmax_p == -1)
+		{
+			break;
+		}
+
+		logger.write(Debug, "swap %u: %u -> %u, value = %f!\n", iter,
+				g.get_inds()[argmax_p], argmax_j, maxval);
+
+		selected[g.get_inds()[argmax_p]] = false;
+		selected[argmax_j] = true;
+
+		g.remove(argmax_p);
+		g.add(argmax_j);
+		value = g.get_value();
+		++iter;
+	}
+
+	std::vector<index_t> inds = g.get_inds();
+	std::sort(inds.begin(), inds.end());
+
+	logger.write(Debug, "g(S) = %f after %u swaps!\n", value, iter);
+	if (logger.get_loglevel() >= Debug)
+	{
+		logger.print_vector(inds);
+	}
+
+	if (cache != nullptr)
+	{
+		std::vector<index_t> key(inds);
+		key.push_back(N);
+		if (index_map != nullptr)
+		{
+			std::for_each(key.begin(), key.end(), [this](index_t& val)
+			{
+				val = (*index_map)[val];
+			});
+		}
+		cache->insert(key, value);
+	}
+
+	return std::make_pair(value, inds);
+}
+
+template <template <class> class Regularizer, typename T>
+void SwapLocalSearch<Regularizer, T>::set_params(param_type _params)
+{
+	params = _params;
+}
+
+template <template <class> class Regularizer, typename T>
+void SwapLocalSearch<Regularizer, T>::set_initial(const std::vector<index_t>& _initial)
+{
+	initial = _initial;
+	has_initial = true;
+}
+
+template <template <class> class Regularizer, typename T>
+void SwapLocalSearch<Regularizer, T>::set_cache(SubsetCache<T>* _cache,
+		const std::vector<index_t>* _index_map)
+{
+	cache = _cache;
+	index_map = _index_map;
+}
+
+template class SwapLocalSearchParam<DummyRegularizer, float64_t>;
+template class SwapLocalSearchParam<SmoothedDifferentialEntropy, float64_t>;
+template class SwapLocalSearchParam<SpectralVariance, float64_t>;
+template class SwapLocalSearch<DummyRegularizer, float64_t>;
+template class SwapLocalSearch<SmoothedDifferentialEntropy, float64_t>;
+template class SwapLocalSearch<SpectralVariance, float64_t>;
+
+template class SwapLocalSearchParam<DummyRegularizer, float32_t>;
+template class SwapLocalSearchParam<SmoothedDifferentialEntropy, float32_t>;
+template class SwapLocalSearchParam<SpectralVariance, float32_t>;
+template class SwapLocalSearch<DummyRegularizer, float32_t>;
+template class SwapLocalSearch<SmoothedDifferentialEntropy, float32_t>;
+template class SwapLocalSearch<SpectralVariance, float32_t>;
@@ -0,0 +1,133 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SWAP_LOCAL_SEARCH_H__
+#define SWAP_LOCAL_SEARCH_H__
+
+#include <tesseract/base/types.h>
+
+namespace tesseract
+{
+
+template <typename T> class SubsetCache;
+
+/** @brief struct for parameters used in swap local-search */
+template <template <class> class Regularizer, typename T>
+struct SwapLocalSearchParam
+{
+	/** regularizer param type */
+	typedef typename Regularizer<T>::param_type reg_param_type;
+
+	/** default constructor */
+	SwapLocalSearchParam();
+
+	/** constructor */
+	SwapLocalSearchParam(T _eta, reg_param_type reg_params);
+
+	/** regularization constant \f$\eta > 0\f$ */
+	T eta;
+
+	/** regularizer params */
+	reg_param_type regularizer_params;
+
+	/** number of threads for evaluating the candidates (0 uses all cores) */
+	index_t num_threads;
+
+	/** maximum number of swaps (0 for no limit) */
+	index_t max_iters;
+
+	/** time budget in seconds after which no more swaps are tried (0 for no
+	 * limit)
+	 */
+	float64_t time_budget;
+};
+
+/** @brief class SwapLocalSearch which refines a set of features of a fixed size,
+ * e.g. the output of forward regression, by best-improvement 1-swaps. In each
+ * iteration every exchange of a selected feature \f$p\f$ for an unselected one
+ * \f$j\f$ is scored as an extension of \f$S\setminus\{p\}\f$, whose factor is
+ * downdated from the one of \f$S\f$, and the best one is performed as long as
+ * it improves the objective
+ */
+template <template <class> class Regularizer, typename T>
+class SwapLocalSearch
+{
+public:
+	/** parameter type */
+	typedef SwapLocalSearchParam<Regularizer, T> param_type;
+
+	/** constructor
+	 * @param _cov the covariance matrix
+	 * @param _target_feats number of target features, used for computing the
+	 * initial set by forward regression if it's not given (default value is 0)
+	 */
+	SwapLocalSearch(const Eigen::Ref<const Matrix<T>>& _cov, index_t _target_feats = 0);
+
+	/** destructor */
+	~SwapLocalSearch();
+
+	/** @return a pair of the function value and selected feature indices */
+	std::pair<T,std::vector<index_t>> run();
+
+	/** @param params the parameters of the algorithm */
+	void set_params(param_type _params);
+
+	/** @param _initial the set to start the swaps from, its size is kept by
+	 * the algorithm
+	 */
+	void set_initial(const std::vector<index_t>& _initial);
+
+	/** @param _cache the cache of the objective values of the subsets, see
+	 * ComputeFunction::set_cache(). The value of the final set is put in it
+	 * @param _index_map maps the indices of the covariance matrix to the ones of
+	 * the cache keys (nullptr if the indices are the same)
+	 */
+	void set_cache(SubsetCache<T>* _cache, const std::vector<index_t>* _index_map = nullptr);
+
+private:
+	/** real valued dense covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** number of target features */
+	index_t target_feats;
+
+	/** the algorithm params */
+	param_type params;
+
+	/** whether the initial set is given */
+	bool has_initial;
+
+	/** the initial set */
+	std::vector<index_t> initial;
+
+	/** the cache of the objective values */
+	SubsetCache<T>* cache;
+
+	/** the map from the indices to the ones of the cache keys */
+	const std::vector<index_t>* index_map;
+};
+
+}
+
+#endif // SWAP_LOCAL_SEARCH_H__
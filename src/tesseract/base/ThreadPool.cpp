@@ -0,0 +1,178 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/base/ThreadPool.hpp>
+#include <algorithm>
+#include <exception>
+
+using namespace tesseract;
+
+ThreadPool::ThreadPool(index_t _num_threads)
+: num_threads(_num_threads), stop(false)
+{
+	if (num_threads == 0)
+	{
+		num_threads = std::max<index_t>(std::thread::hardware_concurrency(), 1);
+	}
+
+	// the caller is one of the threads
+	for (index_t i = 1; i < num_threads; ++i)
+	{
+		workers.push_back(std::thread(&ThreadPool::work, this));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		stop = true;
+	}
+	cond.notify_all();
+
+	for (index_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+}
+
+index_t ThreadPool::get_num_threads() const
+{
+	return num_threads;
+}
+
+std::future<void> ThreadPool::submit(std::function<void()> task)
+{
+	std::packaged_task<void()> packaged(task);
+	std::future<void> future = packaged.get_future();
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		tasks.push_back(std::move(packaged));
+	}
+	cond.notify_one();
+
+	return future;
+}
+
+void ThreadPool::wait(std::future<void>& future)
+{
+	// help with the pending tasks, once the queue is empty the awaited
+	// task is either done or being executed by some other thread
+	while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+	{
+		if (!run_pending_task())
+		{
+			future.wait();
+		}
+	}
+
+	// rethrows the exception thrown by the task, if any
+	future.get();
+}
+
+void ThreadPool::parallel_for(index_t n, std::function<void(index_t,index_t,index_t)> body)
+{
+	index_t chunk_size = (n + num_threads - 1) / num_threads;
+
+	std::vector<std::future<void>> futures;
+	for (index_t t = 1; t < num_threads; ++t)
+	{
+		index_t begin = std::min(n, t * chunk_size);
+		index_t end = std::min(n, begin + chunk_size);
+		futures.push_back(submit(std::bind(body, t, begin, end)));
+	}
+
+	// the first chunk is executed by the caller, make sure that all the
+	// chunks are finished before an exception leaves this scope
+	std::exception_ptr error;
+	try
+	{
+		body(0, 0, std::min(n, chunk_size));
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+
+	for (index_t t = 0; t < futures.size(); ++t)
+	{
+		try
+		{
+			wait(futures[t]);
+		}
+		catch (...)
+		{
+			if (!error)
+				error = std::current_exception();
+		}
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
+
+bool ThreadPool::run_pending_task()
+{
+	std::packaged_task<void()> task;
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		if (tasks.empty())
+		{
+			return false;
+		}
+		task = std::move(tasks.front());
+		tasks.pop_front();
+	}
+
+	task();
+	return true;
+}
+
+void ThreadPool::work()
+{
+	while (true)
+	{
+		std::packaged_task<void()> task;
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond.wait(lock, [this]() { return stop || !tasks.empty(); });
+
+			if (stop && tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+
+		task();
+	}
+}
@@ -0,0 +1,106 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef THREAD_POOL_H__
+#define THREAD_POOL_H__
+
+#include <tesseract/base/types.h>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <functional>
+
+namespace tesseract
+{
+
+/** @brief class ThreadPool for executing tasks on a fixed number of threads.
+ * The calling thread takes part in the computation, so a pool with n threads
+ * starts n-1 workers and a pool with 1 thread runs everything serially in the
+ * caller. While waiting for a task, the caller executes pending tasks itself,
+ * which makes it safe to use the pool from inside its own tasks.
+ */
+class ThreadPool
+{
+public:
+	/** constructor
+	 * @param _num_threads the number of threads (0 uses the number of cores)
+	 */
+	explicit ThreadPool(index_t _num_threads = 1);
+
+	/** destructor, waits for the workers to finish */
+	~ThreadPool();
+
+	/** @return the number of threads (including the caller) */
+	index_t get_num_threads() const;
+
+	/** @param task the task to be executed by the pool
+	 * @return the future to wait for the task
+	 */
+	std::future<void> submit(std::function<void()> task);
+
+	/** waits for a submitted task, executing pending tasks in the meantime
+	 * @param future the future returned by submit()
+	 */
+	void wait(std::future<void>& future);
+
+	/** splits the range [0,n) into get_num_threads() contiguous chunks and
+	 * executes them in parallel, returns when all of them are done
+	 * @param n the size of the range
+	 * @param body the function to be called as body(chunk, begin, end)
+	 */
+	void parallel_for(index_t n, std::function<void(index_t,index_t,index_t)> body);
+
+private:
+	/** @return whether a pending task was found and executed */
+	bool run_pending_task();
+
+	/** the main loop of the workers */
+	void work();
+
+	/** number of threads (including the caller) */
+	index_t num_threads;
+
+	/** the worker threads */
+	std::vector<std::thread> workers;
+
+	/** the pending tasks */
+	std::deque<std::packaged_task<void()>> tasks;
+
+	/** mutex guarding the tasks queue */
+	std::mutex mutex;
+
+	/** condition variable for signalling the workers */
+	std::condition_variable cond;
+
+	/** whether the workers should stop */
+	bool stop;
+};
+
+}
+
+#endif // THREAD_POOL_H__
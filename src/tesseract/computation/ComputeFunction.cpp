@@ -23,32 +23,38 @@
  */
 
 #include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/computation/SubsetCache.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
+#include <algorithm>
 
 using namespace tesseract;
 
-template <template <class> class Regularizer, typename T>
-ComputeFunction<Regularizer, T>::ComputeFunction() : eta(default_eta)
+template <template <class> class Regularizer, typename T, typename Acc>
+ComputeFunction<Regularizer, T, Acc>::ComputeFunction()
+: eta(default_eta), cache(nullptr), index_map(nullptr)
 {
 }
 
-template <template <class> class Regularizer, typename T>
-const T ComputeFunction<Regularizer, T>::operator ()(const Eigen::Ref<const Matrix<T>>& cov) const
+template <template <class> class Regularizer, typename T, typename Acc>
+const T ComputeFunction<Regularizer, T, Acc>::operator ()(const Eigen::Ref<const Matrix<T>>& cov) const
 {
 	index_t N = cov.rows() - 1;
 
+	// the solve accumulates in Acc, which may be wider than T
+	typedef Acc acc_type;
+
 	// evaluate the squared multiple correlation which is b_S.C_S^{-1} b_S
 	T R_sq = 0;
 
 	// avoid nan values when the C_S matrix is singular
 	// TODO think of using Moore-Penrose pseudo-inverse
-	if (cov.topLeftCorner(N, N).diagonal().minCoeff() > std::numeric_limits<float64_t>::epsilon())
+	if (cov.topLeftCorner(N, N).diagonal().minCoeff() > std::numeric_limits<T>::epsilon())
 	{
-		auto& b_S = cov.rightCols(1).topRows(N);
-		Eigen::Map<Vector<T>> b_S_map(const_cast<float64_t*>(b_S.data()), N);
-		R_sq = b_S_map.dot(cov.topLeftCorner(N, N).llt().solve(b_S_map));
+		Vector<acc_type> b_S = cov.rightCols(1).topRows(N).template cast<acc_type>();
+		R_sq = b_S.dot(cov.topLeftCorner(N, N).template cast<acc_type>().llt().solve(b_S));
 	}
 
 	// compute the regularizer on C_S
@@ -59,19 +65,62 @@ const T ComputeFunction<Regularizer, T>::operator ()(const Eigen::Ref<const Matr
 	return R_sq + eta * f;
 }
 
-template <template <class> class Regularizer, typename T>
-void ComputeFunction<Regularizer, T>::set_eta(T _eta)
+template <template <class> class Regularizer, typename T, typename Acc>
+const T ComputeFunction<Regularizer, T, Acc>::operator ()(const IndexedCovariance<T>& cov) const
+{
+	if (cache == nullptr)
+	{
+		return (*this)(cov.gather());
+	}
+
+	std::vector<index_t> key = cov.get_inds();
+	if (index_map != nullptr)
+	{
+		std::for_each(key.begin(), key.end(), [this](index_t& val)
+		{
+			val = (*index_map)[val];
+		});
+	}
+
+	T value;
+	if (!cache->find(key, value))
+	{
+		value = (*this)(cov.gather());
+		cache->insert(key, value);
+	}
+
+	return value;
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void ComputeFunction<Regularizer, T, Acc>::set_eta(T _eta)
 {
 	eta = _eta;
 }
 
-template <template <class> class Regularizer, typename T>
-void ComputeFunction<Regularizer, T>::set_reg_params(typename
-		ComputeFunction<Regularizer,T>::reg_param_type _reg_params)
+template <template <class> class Regularizer, typename T, typename Acc>
+void ComputeFunction<Regularizer, T, Acc>::set_reg_params(typename
+		ComputeFunction<Regularizer,T,Acc>::reg_param_type _reg_params)
 {
 	reg_params = _reg_params;
 }
 
+template <template <class> class Regularizer, typename T, typename Acc>
+void ComputeFunction<Regularizer, T, Acc>::set_cache(SubsetCache<T>* _cache,
+		const std::vector<index_t>* _index_map)
+{
+	cache = _cache;
+	index_map = _index_map;
+}
+
 template class ComputeFunction<DummyRegularizer, float64_t>;
 template class ComputeFunction<SmoothedDifferentialEntropy, float64_t>;
 template class ComputeFunction<SpectralVariance, float64_t>;
+
+template class ComputeFunction<DummyRegularizer, float32_t>;
+template class ComputeFunction<SmoothedDifferentialEntropy, float32_t>;
+template class ComputeFunction<SpectralVariance, float32_t>;
+
+template class ComputeFunction<DummyRegularizer, float32_t, float64_t>;
+template class ComputeFunction<SmoothedDifferentialEntropy, float32_t, float64_t>;
+template class ComputeFunction<SpectralVariance, float32_t, float64_t>;
@@ -26,13 +26,18 @@
 #define COMPUTE_FUNCTION_H__
 
 #include <tesseract/base/types.h>
+#include <vector>
 
 namespace tesseract
 {
 
-/** @brief template class ComputeFunction for computing the objective function
+template <typename T> class IndexedCovariance;
+template <typename T> class SubsetCache;
+
+/** @brief template class ComputeFunction for computing the objective function.
+ * The solve accumulates in Acc, which may be wider than T
  */
-template <template <class> class Regularizer, typename T>
+template <template <class> class Regularizer, typename T, typename Acc = T>
 struct ComputeFunction
 {
 	/** regularizer param */
@@ -48,18 +53,40 @@ struct ComputeFunction
 	 */
 	const T operator ()(const Eigen::Ref<const Matrix<T>>& cov) const;
 
+	/*
+	 * @param cov the view of the covariance matrix C_S and b_S (the last index
+	 * corresponds to b_S), gathered into a thread-local workspace. The value
+	 * is looked up in (and added to) the cache if one is set
+	 * @return the function value
+	 */
+	const T operator ()(const IndexedCovariance<T>& cov) const;
+
 	/** @param _eta regularization constant */
 	void set_eta(T _eta);
 
 	/** @param _param regularizer params */
 	void set_reg_params(reg_param_type _reg_params);
 
+	/** @param _cache the cache of the values of the subsets (nullptr disables it),
+	 * it has to be owned by the caller
+	 * @param _index_map maps the indices of the covariance matrix to the ones of
+	 * the cache keys, if the matrix is a submatrix of the one the cache is for
+	 * (nullptr if the indices are the same)
+	 */
+	void set_cache(SubsetCache<T>* _cache, const std::vector<index_t>* _index_map = nullptr);
+
 	/** regularization constant \f$\eta > 0\f$ */
 	T eta;
 
 	/** regularizer params */
 	reg_param_type reg_params;
 
+	/** the cache of the values of the subsets */
+	SubsetCache<T>* cache;
+
+	/** the map from the indices to the ones of the cache keys */
+	const std::vector<index_t>* index_map;
+
 	/** default value of eta = 0.0001 */
 	static constexpr T default_eta = static_cast<T>(0.0001);
 };
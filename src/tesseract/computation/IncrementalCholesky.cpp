@@ -0,0 +1,169 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/computation/IncrementalCholesky.hpp>
+#include <cmath>
+
+using namespace tesseract;
+
+template <typename T>
+IncrementalCholesky<T>::IncrementalCholesky(index_t capacity)
+: L(capacity, capacity), k(0)
+{
+}
+
+template <typename T>
+IncrementalCholesky<T>::~IncrementalCholesky()
+{
+}
+
+template <typename T>
+index_t IncrementalCholesky<T>::size() const
+{
+	return k;
+}
+
+template <typename T>
+void IncrementalCholesky<T>::clear()
+{
+	k = 0;
+}
+
+template <typename T>
+void IncrementalCholesky<T>::forward_solve(Eigen::Ref<Vector<T>> b) const
+{
+	assert(b.rows() >= k);
+
+	if (k > 0)
+	{
+		auto x = b.head(k);
+		L.topLeftCorner(k, k).template triangularView<Eigen::Lower>().solveInPlace(x);
+	}
+}
+
+template <typename T>
+void IncrementalCholesky<T>::forward_solve_columns(Eigen::Ref<Matrix<T>> B) const
+{
+	assert(B.rows() >= k);
+
+	if (k > 0 && B.cols() > 0)
+	{
+		auto X = B.topRows(k);
+		L.topLeftCorner(k, k).template triangularView<Eigen::Lower>().solveInPlace(X);
+	}
+}
+
+template <typename T>
+const T IncrementalCholesky<T>::pivot(Eigen::Ref<Vector<T>> cross, T diag) const
+{
+	forward_solve(cross);
+	return diag - cross.head(k).squaredNorm();
+}
+
+template <typename T>
+void IncrementalCholesky<T>::extend(const Eigen::Ref<const Vector<T>>& l, T d_sq)
+{
+	assert(l.rows() >= k);
+	assert(d_sq > 0);
+
+	// grow the storage geometrically if we run out of reserved memory
+	if (k >= L.rows())
+	{
+		index_t capacity = std::max<index_t>(2 * L.rows(), 1);
+		L.conservativeResize(capacity, capacity);
+	}
+
+	L.row(k).head(k) = l.head(k).transpose();
+	L(k, k) = sqrt(d_sq);
+	k++;
+}
+
+template <typename T>
+const T IncrementalCholesky<T>::removal_pivot(index_t i) const
+{
+	assert(i < k);
+
+	// (C_S^{-1})_{ii} = ||L^{-1}e_i||^2 and the first i entries of L^{-1}e_i
+	// are zero, so only the trailing block is needed
+	index_t m = k - i;
+	Vector<T> x = Vector<T>::Zero(m);
+	x[0] = 1;
+	L.block(i, i, m, m).template triangularView<Eigen::Lower>().solveInPlace(x);
+
+	return 1 / x.squaredNorm();
+}
+
+template <typename T>
+void IncrementalCholesky<T>::remove(index_t i)
+{
+	assert(i < k);
+
+	// without row and column i, the trailing block L_33 has to be replaced by
+	// the factor of L_33 L_33^T + v v^T where v is the column below L_ii
+	index_t m = k - i - 1;
+	Vector<T> v = L.col(i).segment(i + 1, m);
+
+	for (index_t p = 0; p < m; ++p)
+	{
+		index_t r = i + 1 + p;
+		T l_pp = L(r, r);
+		T h = sqrt(l_pp * l_pp + v[p] * v[p]);
+		T c = h / l_pp;
+		T s = v[p] / l_pp;
+		L(r, r) = h;
+
+		for (index_t q = p + 1; q < m; ++q)
+		{
+			index_t t = i + 1 + q;
+			L(t, r) = (L(t, r) + s * v[q]) / c;
+			v[q] = c * v[q] - s * L(t, r);
+		}
+	}
+
+	// move the rows below i one up and the columns right of i one left
+	for (index_t r = i; r + 1 < k; ++r)
+	{
+		L.row(r).head(i) = L.row(r + 1).head(i);
+		L.row(r).segment(i, r - i + 1) = L.row(r + 1).segment(i + 1, r - i + 1);
+	}
+
+	k--;
+}
+
+template <typename T>
+const T IncrementalCholesky<T>::log_det() const
+{
+	return 2 * L.diagonal().head(k).array().log().sum();
+}
+
+template <typename T>
+const Eigen::Ref<const Matrix<T>> IncrementalCholesky<T>::get_factor() const
+{
+	return L.topLeftCorner(k, k);
+}
+
+template class IncrementalCholesky<float64_t>;
+
+template class IncrementalCholesky<float32_t>;
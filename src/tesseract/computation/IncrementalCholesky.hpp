@@ -0,0 +1,120 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef INCREMENTAL_CHOLESKY_H__
+#define INCREMENTAL_CHOLESKY_H__
+
+#include <tesseract/base/types.h>
+
+namespace tesseract
+{
+
+/** @brief template class IncrementalCholesky for maintaining the lower triangular
+ * Cholesky factor \f$L\f$ of a covariance matrix \f$C_S=LL^T\f$ while features
+ * are added to and removed from \f$S\f$. Adding a feature \f$j\f$ to \f$S\f$
+ * extends the factor by one row \f$[l^T, d]\f$ where \f$l=L^{-1}C_{S,j}\f$ and
+ * \f$d^2=C_{jj}-l^Tl\f$, which costs a single triangular solve instead of a
+ * full factorization. Removing a feature drops its row and column and restores
+ * the trailing block by a rank-one update, both in \f$O(|S|^2)\f$.
+ */
+template <typename T>
+class IncrementalCholesky
+{
+public:
+	/** constructor
+	 * @param capacity the expected maximum size of the factor (memory is
+	 * reserved upfront but grows if required)
+	 */
+	IncrementalCholesky(index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalCholesky();
+
+	/** @return the current size of the factor */
+	index_t size() const;
+
+	/** resets the factor to the empty set */
+	void clear();
+
+	/** solves \f$Lx=b\f$ in place
+	 * @param b the right hand side on entry (first size() entries are used),
+	 * the solution \f$x\f$ on exit
+	 */
+	void forward_solve(Eigen::Ref<Vector<T>> b) const;
+
+	/** solves \f$LX=B\f$ in place for all the columns of \f$B\f$ at once, i.e.
+	 * as a single matrix-matrix triangular solve
+	 * @param B the right hand sides on entry (first size() rows are used), the
+	 * solutions \f$X\f$ on exit
+	 */
+	void forward_solve_columns(Eigen::Ref<Matrix<T>> B) const;
+
+	/** computes the row which would extend the factor by a new feature
+	 * @param cross the cross covariance \f$C_{S,j}\f$ on entry, \f$L^{-1}C_{S,j}\f$
+	 * on exit
+	 * @param diag the variance \f$C_{jj}\f$ of the new feature
+	 * @return the squared pivot \f$d^2=C_{jj}-l^Tl\f$
+	 */
+	const T pivot(Eigen::Ref<Vector<T>> cross, T diag) const;
+
+	/** extends the factor by one row
+	 * @param l the off-diagonal part of the new row as computed by pivot()
+	 * @param d_sq the squared pivot as returned by pivot(), must be positive
+	 */
+	void extend(const Eigen::Ref<const Vector<T>>& l, T d_sq);
+
+	/** computes the pivot which the feature would have if it was added last,
+	 * i.e. \f$\det(C_S)=d^2\det(C_{S\setminus\{i\}})\f$ with
+	 * \f$d^2=1/(C_S^{-1})_{ii}\f$
+	 * @param i the position of the feature in the order of addition
+	 * @return the squared pivot \f$d^2\f$
+	 */
+	const T removal_pivot(index_t i) const;
+
+	/** removes the row and column of a feature from the factor
+	 * @param i the position of the feature in the order of addition, the later
+	 * features move one position up
+	 */
+	void remove(index_t i);
+
+	/** @return the \f$\log\det(C_S)=2\sum_i\log L_{ii}\f$ */
+	const T log_det() const;
+
+	/** @return the lower triangular factor \f$L\f$ */
+	const Eigen::Ref<const Matrix<T>> get_factor() const;
+
+private:
+	/** storage of the factor, only the top-left size() x size() lower
+	 * triangular part is in use
+	 */
+	Matrix<T> L;
+
+	/** current size of the factor */
+	index_t k;
+};
+
+}
+
+#endif // INCREMENTAL_CHOLESKY_H__
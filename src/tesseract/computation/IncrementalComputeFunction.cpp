@@ -0,0 +1,348 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/computation/IncrementalComputeFunction.hpp>
+#include <tesseract/computation/ComputeFunction.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T, typename Acc>
+IncrementalComputeFunction<Regularizer, T, Acc>::IncrementalComputeFunction(
+		const Eigen::Ref<const Matrix<T>>& _cov, index_t capacity)
+: cov(_cov), N(_cov.cols() - 1), eta(ComputeFunction<Regularizer,T>::default_eta),
+	reg(capacity), chol(capacity), z(capacity), R_sq(0), singular(false), clamped(false), value(0)
+{
+	inds.reserve(capacity);
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+IncrementalComputeFunction<Regularizer, T, Acc>::~IncrementalComputeFunction()
+{
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+const T IncrementalComputeFunction<Regularizer, T, Acc>::operator ()(index_t j,
+		Workspace& work) const
+{
+	index_t k = inds.size();
+
+	// evaluate the squared multiple correlation which is b_S.C_S^{-1} b_S
+	// avoid nan values when the C_S matrix is singular
+	acc_type R_sq_j = 0;
+	acc_type c_jj = cov(j, j);
+
+	if (!singular && c_jj > std::numeric_limits<T>::epsilon())
+	{
+		// gather C_{S,j} and compute l = L^{-1} C_{S,j}
+		gather_cross(j, work.cross);
+		acc_type d_sq = chol.pivot(work.cross, c_jj);
+
+		// if j is (numerically) in the span of S, it doesn't explain anything more
+		R_sq_j = R_sq;
+		if (d_sq > std::numeric_limits<T>::epsilon() * c_jj)
+		{
+			acc_type z_j = (cov(j, N) - work.cross.head(k).dot(z.head(k))) / sqrt(d_sq);
+			R_sq_j += z_j * z_j;
+		}
+	}
+
+	// compute the regularizer on C_{S+j}
+	T f = 0;
+	if (eta != 0)
+	{
+		f = regularizer_value(j, work);
+	}
+
+	return static_cast<T>(R_sq_j + eta * f);
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::score_extensions(
+		const std::vector<index_t>& candidates, Eigen::Ref<Vector<T>> values,
+		Workspace& work) const
+{
+	index_t k = inds.size();
+	index_t m = candidates.size();
+	assert(values.rows() >= m);
+
+	work.diags.resize(m);
+	for (index_t c = 0; c < m; ++c)
+	{
+		work.diags[c] = cov(candidates[c], candidates[c]);
+	}
+
+	// gather C_{S,J} for all the candidates J at once
+	work.crosses.resize(k, m);
+	for (index_t c = 0; c < m; ++c)
+	{
+		for (index_t i = 0; i < k; ++i)
+		{
+			work.crosses(i, c) = cov(inds[i], candidates[c]);
+		}
+	}
+
+	// compute the regularizer on C_{S+j} for all the candidates, on a copy
+	// since the extensions overwrite the cross covariances
+	work.reg_values.resize(m);
+	if (eta != 0)
+	{
+		work.reg_crosses = work.crosses.template cast<T>();
+		reg.extensions(work.reg_crosses, work.diags, work.reg_values);
+	}
+	else
+	{
+		work.reg_values.setZero();
+	}
+
+	// avoid nan values when the C_S matrix is singular
+	if (singular)
+	{
+		values.head(m) = eta * work.reg_values;
+		return;
+	}
+
+	// compute L^{-1} C_{S,J} for all the candidates J at once
+	chol.forward_solve_columns(work.crosses);
+	work.projs.noalias() = work.crosses.transpose() * z.head(k);
+
+	for (index_t c = 0; c < m; ++c)
+	{
+		// the same as operator() for each of the candidates
+		acc_type R_sq_j = 0;
+		acc_type c_jj = work.diags[c];
+
+		if (c_jj > std::numeric_limits<T>::epsilon())
+		{
+			acc_type d_sq = c_jj - work.crosses.col(c).squaredNorm();
+
+			// if j is (numerically) in the span of S, it doesn't explain anything more
+			R_sq_j = R_sq;
+			if (d_sq > std::numeric_limits<T>::epsilon() * c_jj)
+			{
+				acc_type z_j = (cov(candidates[c], N) - work.projs[c]) / sqrt(d_sq);
+				R_sq_j += z_j * z_j;
+			}
+		}
+
+		values[c] = static_cast<T>(R_sq_j + eta * work.reg_values[c]);
+	}
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::add(index_t j)
+{
+	assert(j < N);
+	assert(std::find(inds.begin(), inds.end(), j) == inds.end());
+
+	Workspace work;
+	value = (*this)(j, work);
+
+	index_t k = inds.size();
+	T c_jj = cov(j, j);
+
+	Vector<T> cross;
+	gather_cross(j, cross);
+	reg.add(cross, c_jj);
+
+	if (c_jj > std::numeric_limits<T>::epsilon())
+	{
+		// recompute the new row of the factor since the evaluation above skips
+		// it for singular sets
+		Vector<acc_type> l;
+		gather_cross(j, l);
+		acc_type d_sq = chol.pivot(l, c_jj);
+
+		if (z.rows() <= k)
+			z.conservativeResize(std::max<index_t>(2 * z.rows(), k + 1));
+
+		// if j is in the span of S, it doesn't contribute to R^2 but we still
+		// keep the factor positive definite
+		if (d_sq > std::numeric_limits<T>::epsilon() * c_jj)
+		{
+			z[k] = (cov(j, N) - l.head(k).dot(z.head(k))) / sqrt(d_sq);
+		}
+		else
+		{
+			z[k] = 0;
+			d_sq = std::numeric_limits<T>::epsilon() * c_jj;
+			clamped = true;
+		}
+		chol.extend(l, d_sq);
+	}
+	else
+	{
+		singular = true;
+	}
+
+	inds.push_back(j);
+
+	// keep R^2 consistent with the definition of operator()
+	if (!singular)
+	{
+		R_sq = z.head(inds.size()).squaredNorm();
+	}
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::remove(index_t i)
+{
+	assert(i < inds.size());
+
+	// the factor doesn't correspond to C_S one to one, so start over
+	if (singular || clamped)
+	{
+		std::vector<index_t> rest(inds);
+		rest.erase(rest.begin() + i);
+
+		clear();
+		for (index_t j = 0; j < rest.size(); ++j)
+		{
+			add(rest[j]);
+		}
+		return;
+	}
+
+	// the column of C_S of the feature in the order of addition
+	index_t k = inds.size();
+	Vector<T> cross(k);
+	for (index_t r = 0; r < k; ++r)
+	{
+		cross[r] = cov(inds[r], inds[i]);
+	}
+
+	T f = 0;
+	if (eta != 0)
+	{
+		f = reg.removal(i, cross);
+	}
+	reg.remove(i, cross);
+
+	chol.remove(i);
+	inds.erase(inds.begin() + i);
+
+	// recompute z=L^{-1}b_S on the downdated factor
+	k = inds.size();
+	for (index_t r = 0; r < k; ++r)
+	{
+		z[r] = cov(inds[r], N);
+	}
+	chol.forward_solve(z.head(k));
+
+	R_sq = z.head(k).squaredNorm();
+	value = static_cast<T>(R_sq + eta * f);
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::clear()
+{
+	inds.clear();
+	reg.clear();
+	chol.clear();
+	R_sq = 0;
+	singular = false;
+	clamped = false;
+	value = 0;
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+const std::vector<index_t>& IncrementalComputeFunction<Regularizer, T, Acc>::get_inds() const
+{
+	return inds;
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+const T IncrementalComputeFunction<Regularizer, T, Acc>::get_value() const
+{
+	return value;
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::set_eta(T _eta)
+{
+	eta = _eta;
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+void IncrementalComputeFunction<Regularizer, T, Acc>::set_reg_params(typename
+		IncrementalComputeFunction<Regularizer,T,Acc>::reg_param_type _reg_params)
+{
+	reg.set_params(_reg_params);
+
+	// rebuild the regularizer state for the current set
+	reg.clear();
+	Vector<T> cross;
+	for (index_t i = 0; i < inds.size(); ++i)
+	{
+		cross.resize(i + 1);
+		for (index_t r = 0; r < i; ++r)
+		{
+			cross[r] = cov(inds[r], inds[i]);
+		}
+		reg.add(cross, cov(inds[i], inds[i]));
+	}
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+const T IncrementalComputeFunction<Regularizer, T, Acc>::regularizer_value(index_t j,
+		Workspace& work) const
+{
+	gather_cross(j, work.reg_cross);
+	return reg.extension(work.reg_cross, cov(j, j));
+}
+
+template <template <class> class Regularizer, typename T, typename Acc>
+template <typename S>
+void IncrementalComputeFunction<Regularizer, T, Acc>::gather_cross(index_t j,
+		Vector<S>& cross) const
+{
+	index_t k = inds.size();
+
+	// one spare entry so that the vector can hold the new row of a factor
+	if (cross.rows() < k + 1)
+		cross.resize(std::max<index_t>(inds.capacity(), k) + 1);
+
+	for (index_t i = 0; i < k; ++i)
+	{
+		cross[i] = cov(inds[i], j);
+	}
+}
+
+template class IncrementalComputeFunction<DummyRegularizer, float64_t>;
+template class IncrementalComputeFunction<SmoothedDifferentialEntropy, float64_t>;
+template class IncrementalComputeFunction<SpectralVariance, float64_t>;
+
+template class IncrementalComputeFunction<DummyRegularizer, float32_t>;
+template class IncrementalComputeFunction<SmoothedDifferentialEntropy, float32_t>;
+template class IncrementalComputeFunction<SpectralVariance, float32_t>;
+
+template class IncrementalComputeFunction<DummyRegularizer, float32_t, float64_t>;
+template class IncrementalComputeFunction<SmoothedDifferentialEntropy, float32_t, float64_t>;
+template class IncrementalComputeFunction<SpectralVariance, float32_t, float64_t>;
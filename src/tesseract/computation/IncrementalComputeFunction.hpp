@@ -0,0 +1,186 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef INCREMENTAL_COMPUTE_FUNCTION_H__
+#define INCREMENTAL_COMPUTE_FUNCTION_H__
+
+#include <tesseract/base/types.h>
+#include <tesseract/computation/IncrementalCholesky.hpp>
+#include <tesseract/regularizer/IncrementalRegularizer.hpp>
+#include <vector>
+
+namespace tesseract
+{
+
+/** @brief template class IncrementalComputeFunction for computing the objective
+ * function \f$g(S\cup\{j\})\f$ for the candidates of a growing set \f$S\f$.
+ * It keeps the Cholesky factor \f$C_S=LL^T\f$ and \f$z=L^{-1}b_S\f$ across
+ * additions so that the squared multiple correlation of an extension is
+ * \f$R^2_{S\cup\{j\}}=R^2_S+\frac{(b_j-l^Tz)^2}{d^2}\f$ with
+ * \f$l=L^{-1}C_{S,j}\f$ and \f$d^2=C_{jj}-l^Tl\f$, i.e. one triangular solve
+ * per candidate instead of a full factorization of \f$C_{S\cup\{j\}}\f$.
+ * The regularizer is evaluated likewise by an IncrementalRegularizer.
+ *
+ * The solves accumulate in Acc, which may be wider than T, e.g. a float32_t
+ * covariance matrix (halving the memory traffic) solved in float64_t.
+ */
+template <template <class> class Regularizer, typename T, typename Acc = T>
+class IncrementalComputeFunction
+{
+public:
+	/** regularizer param */
+	typedef typename Regularizer<T>::param_type reg_param_type;
+
+	/** the type in which the solves accumulate */
+	typedef Acc acc_type;
+
+	/** @brief scratch memory used while evaluating the extensions */
+	struct Workspace
+	{
+		/** the cross covariance \f$C_{S,j}\f$ */
+		Vector<acc_type> cross;
+
+		/** the cross covariance \f$C_{S,j}\f$ for the regularizer */
+		Vector<T> reg_cross;
+
+		/** the cross covariances of a batch of candidates as columns */
+		Matrix<acc_type> crosses;
+
+		/** the cross covariances of a batch of candidates for the regularizer */
+		Matrix<T> reg_crosses;
+
+		/** the variances of a batch of candidates */
+		Vector<T> diags;
+
+		/** \f$l^Tz\f$ of a batch of candidates */
+		Vector<acc_type> projs;
+
+		/** the regularizer values of a batch of candidates */
+		Vector<T> reg_values;
+	};
+
+	/** constructor
+	 * @param _cov the covariance matrix (the last row and col corresponds to b)
+	 * @param capacity the expected maximum size of the set \f$S\f$
+	 */
+	IncrementalComputeFunction(const Eigen::Ref<const Matrix<T>>& _cov,
+			index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalComputeFunction();
+
+	/**
+	 * @param j the index of the candidate feature (must not be in \f$S\f$)
+	 * @param work the scratch memory for the evaluation
+	 * @return the function value \f$g(S\cup\{j\})\f$
+	 */
+	const T operator ()(index_t j, Workspace& work) const;
+
+	/** evaluates a batch of candidates at once. Their cross covariances are
+	 * solved against the factor of \f$C_S\f$ in a single matrix-matrix
+	 * triangular solve instead of one triangular solve per candidate
+	 * @param candidates the indices of the candidate features (must not be in
+	 * \f$S\f$)
+	 * @param values the function values \f$g(S\cup\{j\})\f$ on exit
+	 * @param work the scratch memory for the evaluation
+	 */
+	void score_extensions(const std::vector<index_t>& candidates,
+			Eigen::Ref<Vector<T>> values, Workspace& work) const;
+
+	/** @param j the index of the feature to be added to \f$S\f$ */
+	void add(index_t j);
+
+	/** removes a feature from the set \f$S\f$, the later features move one
+	 * position up in the order of addition. The factor is downdated in
+	 * \f$O(|S|^2)\f$ unless it skips or clamps a pivot, in which case it's
+	 * rebuilt
+	 * @param i the position of the feature in the order of addition
+	 */
+	void remove(index_t i);
+
+	/** resets the set \f$S\f$ to the empty set */
+	void clear();
+
+	/** @return the indices of the features in \f$S\f$ in order of addition */
+	const std::vector<index_t>& get_inds() const;
+
+	/** @return the function value \f$g(S)\f$ */
+	const T get_value() const;
+
+	/** @param _eta regularization constant */
+	void set_eta(T _eta);
+
+	/** @param _param regularizer params (keeps the set \f$S\f$) */
+	void set_reg_params(reg_param_type _reg_params);
+
+private:
+	/** evaluates the regularizer on \f$C_{S\cup\{j\}}\f$ */
+	const T regularizer_value(index_t j, Workspace& work) const;
+
+	/** gathers \f$C_{S,j}\f$ into the given vector */
+	template <typename S>
+	void gather_cross(index_t j, Vector<S>& cross) const;
+
+	/** real valued dense covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** number of features */
+	index_t N;
+
+	/** regularization constant \f$\eta > 0\f$ */
+	T eta;
+
+	/** the regularizer on \f$C_S\f$ */
+	IncrementalRegularizer<Regularizer, T> reg;
+
+	/** the indices in \f$S\f$ */
+	std::vector<index_t> inds;
+
+	/** the Cholesky factor of \f$C_S\f$ */
+	IncrementalCholesky<acc_type> chol;
+
+	/** \f$z=L^{-1}b_S\f$ */
+	Vector<acc_type> z;
+
+	/** the squared multiple correlation \f$R^2_S=z^Tz\f$ */
+	acc_type R_sq;
+
+	/** whether \f$C_S\f$ has a (numerically) zero diagonal entry in which case
+	 * the squared multiple correlation is taken to be 0
+	 */
+	bool singular;
+
+	/** whether a pivot of the factor was clamped since its feature is
+	 * (numerically) in the span of the others
+	 */
+	bool clamped;
+
+	/** the function value \f$g(S)\f$ */
+	T value;
+};
+
+}
+
+#endif // INCREMENTAL_COMPUTE_FUNCTION_H__
@@ -0,0 +1,150 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/computation/SubsetCache.hpp>
+#include <algorithm>
+
+using namespace tesseract;
+
+template <typename T>
+SubsetCache<T>::SubsetCache(index_t _capacity)
+: capacity(_capacity), num_hits(0), num_misses(0)
+{
+	assert(capacity > 0);
+}
+
+template <typename T>
+SubsetCache<T>::~SubsetCache()
+{
+}
+
+template <typename T>
+bool SubsetCache<T>::find(const std::vector<index_t>& inds, T& value)
+{
+	key_type key = make_key(inds);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto it = lookup.find(key);
+	if (it == lookup.end())
+	{
+		num_misses++;
+		return false;
+	}
+
+	// move the entry to the front
+	entries.splice(entries.begin(), entries, it->second);
+	value = it->second->second;
+	num_hits++;
+
+	return true;
+}
+
+template <typename T>
+void SubsetCache<T>::insert(const std::vector<index_t>& inds, T value)
+{
+	key_type key = make_key(inds);
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto it = lookup.find(key);
+	if (it != lookup.end())
+	{
+		it->second->second = value;
+		entries.splice(entries.begin(), entries, it->second);
+		return;
+	}
+
+	// evict the least recently used entry
+	if (entries.size() >= capacity)
+	{
+		lookup.erase(entries.back().first);
+		entries.pop_back();
+	}
+
+	entries.emplace_front(key, value);
+	lookup.emplace(std::move(key), entries.begin());
+}
+
+template <typename T>
+void SubsetCache<T>::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	entries.clear();
+	lookup.clear();
+	num_hits = 0;
+	num_misses = 0;
+}
+
+template <typename T>
+index_t SubsetCache<T>::size() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return entries.size();
+}
+
+template <typename T>
+index_t SubsetCache<T>::get_capacity() const
+{
+	return capacity;
+}
+
+template <typename T>
+index_t SubsetCache<T>::get_num_hits() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return num_hits;
+}
+
+template <typename T>
+index_t SubsetCache<T>::get_num_misses() const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return num_misses;
+}
+
+template <typename T>
+size_t SubsetCache<T>::KeyHash::operator()(const key_type& key) const
+{
+	// FNV-1a over the indices
+	size_t hash = 14695981039346656037ull;
+	for (index_t i : key)
+	{
+		hash ^= i;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+template <typename T>
+typename SubsetCache<T>::key_type SubsetCache<T>::make_key(const std::vector<index_t>& inds)
+{
+	key_type key(inds);
+	std::sort(key.begin(), key.end());
+	return key;
+}
+
+template class SubsetCache<float64_t>;
+template class SubsetCache<float32_t>;
@@ -0,0 +1,126 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SUBSET_CACHE_H__
+#define SUBSET_CACHE_H__
+
+#include <tesseract/base/types.h>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+
+namespace tesseract
+{
+
+/** @brief template class SubsetCache for memoizing the objective function
+ * values of feature subsets. The key is the sorted index set, and the least
+ * recently used entry is evicted once the capacity is reached. The values are
+ * only meaningful for one covariance matrix and one set of objective
+ * parameters, so a cache must not be shared beyond that. The cache is thread
+ * safe.
+ */
+template <typename T>
+class SubsetCache
+{
+public:
+	/** constructor
+	 * @param _capacity the maximum number of cached subsets
+	 */
+	explicit SubsetCache(index_t _capacity = default_capacity);
+
+	/** destructor */
+	~SubsetCache();
+
+	/** looks up the value of a subset and marks it as recently used
+	 * @param inds the indices of the subset (in any order)
+	 * @param value the cached value, if found
+	 * @return whether the subset was found
+	 */
+	bool find(const std::vector<index_t>& inds, T& value);
+
+	/** caches the value of a subset, evicting the least recently used one if
+	 * the cache is full
+	 * @param inds the indices of the subset (in any order)
+	 * @param value the value
+	 */
+	void insert(const std::vector<index_t>& inds, T value);
+
+	/** removes all the cached subsets and resets the counters */
+	void clear();
+
+	/** @return the number of cached subsets */
+	index_t size() const;
+
+	/** @return the maximum number of cached subsets */
+	index_t get_capacity() const;
+
+	/** @return the number of successful lookups */
+	index_t get_num_hits() const;
+
+	/** @return the number of failed lookups */
+	index_t get_num_misses() const;
+
+	/** default capacity */
+	static constexpr index_t default_capacity = 4096;
+
+private:
+	/** the key type, the sorted index set */
+	typedef std::vector<index_t> key_type;
+
+	/** @brief struct KeyHash for hashing the index sets */
+	struct KeyHash
+	{
+		/** @return the hash of the index set */
+		size_t operator()(const key_type& key) const;
+	};
+
+	/** the list of entries, most recently used first */
+	typedef std::list<std::pair<key_type, T>> entry_list;
+
+	/** @return the sorted copy of the indices */
+	static key_type make_key(const std::vector<index_t>& inds);
+
+	/** the maximum number of cached subsets */
+	index_t capacity;
+
+	/** the entries in order of use */
+	entry_list entries;
+
+	/** the entries by their key */
+	std::unordered_map<key_type, typename entry_list::iterator, KeyHash> lookup;
+
+	/** number of successful lookups */
+	index_t num_hits;
+
+	/** number of failed lookups */
+	index_t num_misses;
+
+	/** mutex guarding the cache */
+	mutable std::mutex mutex;
+};
+
+}
+
+#endif // SUBSET_CACHE_H__
@@ -40,8 +40,8 @@ float64_t PearsonsCorrelation<T>::compute(const Eigen::Ref<const Vector<T>> Z, c
 	float64_t sum_Z = std::accumulate(const_cast<T*>(Z.data()), const_cast<T*>(Z.data() + N), 0);
 	float64_t sum_Zp = std::accumulate(const_cast<T*>(Zp.data()), const_cast<T*>(Zp.data() + N), 0);
 
-	Vector<float64_t> mu_Z = Vector<float64_t>::Constant(N, sum_Z / N);
-	Vector<float64_t> mu_Zp = Vector<float64_t>::Constant(N, sum_Zp / N);
+	Vector<T> mu_Z = Vector<T>::Constant(N, sum_Z / N);
+	Vector<T> mu_Zp = Vector<T>::Constant(N, sum_Zp / N);
 
 	// compute sample std dev
 	float64_t s_Z = sqrt((Z - mu_Z).array().template square().template sum() / (N - 1.0));
@@ -58,3 +58,5 @@ float64_t PearsonsCorrelation<T>::compute(const Eigen::Ref<const Vector<T>> Z, c
 }
 
 template class PearsonsCorrelation<float64_t>;
+
+template class PearsonsCorrelation<float32_t>;
@@ -38,3 +38,5 @@ float64_t SquaredMultipleCorrelation<T>::compute(const Eigen::Ref<const Vector<T
 }
 
 template class SquaredMultipleCorrelation<float64_t>;
+
+template class SquaredMultipleCorrelation<float32_t>;
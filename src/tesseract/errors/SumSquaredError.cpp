@@ -37,3 +37,5 @@ float64_t SumSquaredError<T>::compute(const Eigen::Ref<const Vector<T>>& Z, cons
 }
 
 template class SumSquaredError<float64_t>;
+
+template class SumSquaredError<float32_t>;
@@ -29,12 +29,16 @@
 #include <tesseract/io/IDX1Reader.hpp>
 #include <tesseract/io/IDX3Reader.hpp>
 #include <tesseract/io/HousingReader.hpp>
+#include <tesseract/io/CovarianceCache.hpp>
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
 #include <tesseract/errors/SumSquaredError.hpp>
 #include <tesseract/errors/PearsonsCorrelation.hpp>
 #include <tesseract/errors/SquaredMultipleCorrelation.hpp>
 #include <tesseract/algorithm/Dummy.hpp>
 #include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LazyForwardRegression.hpp>
+#include <tesseract/algorithm/StochasticForwardRegression.hpp>
+#include <tesseract/algorithm/OrthogonalMatchingPursuit.hpp>
 #include <tesseract/algorithm/LocalSearch.hpp>
 #include <tesseract/algorithm/LinearLocalSearch.hpp>
 #include <tesseract/algorithm/GreedyLocalSearch.hpp>
@@ -42,36 +46,178 @@
 #include <tesseract/regularizer/DummyRegularizer.hpp>
 #include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
 #include <tesseract/regularizer/SpectralVariance.hpp>
-#include <tesseract/features/Features.hpp>
 #include <map>
+#include <memory>
 #include <type_traits>
 
 using namespace tesseract;
 
+namespace
+{
+
+/** runs the algorithm for every number of target features from 1 to max_feats */
+template <class Algorithm>
+struct SelectionPath
+{
+	static std::vector<std::vector<index_t>> run(const Eigen::Ref<const Matrix<float64_t>>& cov,
+			typename Algorithm::param_type params, index_t max_feats)
+	{
+		std::vector<std::vector<index_t>> path;
+		for (index_t k = 1; k <= max_feats; ++k)
+		{
+			Algorithm algo(cov, k);
+			algo.set_params(params);
+			path.push_back(algo.run().second);
+		}
+		return path;
+	}
+};
+
+/** forward regression selects the features of the whole sweep in one run */
+template <template <class> class Regularizer>
+struct SelectionPath<ForwardRegression<Regularizer,float64_t>>
+{
+	typedef ForwardRegression<Regularizer,float64_t> Algorithm;
+
+	static std::vector<std::vector<index_t>> run(const Eigen::Ref<const Matrix<float64_t>>& cov,
+			typename Algorithm::param_type params, index_t max_feats)
+	{
+		Algorithm algo(cov);
+		algo.set_params(params);
+
+		std::vector<std::vector<index_t>> path;
+		for (auto& step : algo.run_path(max_feats))
+		{
+			path.push_back(step.second);
+		}
+		return path;
+	}
+};
+
+/** greedy local search shares the first forward regression phase of the sweep */
+template <template <template<class>class,typename> class LSAlgo, template <class> class Regularizer>
+struct SelectionPath<GreedyLocalSearch<ForwardRegression,LSAlgo,Regularizer,float64_t>>
+{
+	typedef GreedyLocalSearch<ForwardRegression,LSAlgo,Regularizer,float64_t> Algorithm;
+
+	static std::vector<std::vector<index_t>> run(const Eigen::Ref<const Matrix<float64_t>>& cov,
+			typename Algorithm::param_type params, index_t max_feats)
+	{
+		ForwardRegression<Regularizer,float64_t> fr(cov);
+		fr.set_params(params.fr_params);
+		auto fr_path = fr.run_path(max_feats);
+
+		std::vector<std::vector<index_t>> path;
+		for (index_t k = 1; k <= fr_path.size(); ++k)
+		{
+			Algorithm algo(cov, k);
+			algo.set_params(params);
+			algo.set_fr_result(fr_path[k-1]);
+			path.push_back(algo.run().second);
+		}
+		return path;
+	}
+};
+
+}
+
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
-std::vector<index_t> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::train()
+Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::Evaluation()
+: seed(0), num_examples(0), target_feats(0), has_train_cov(false), has_test_gram(false)
 {
-	logger.write(Debug, "%s: Entering!\n", __PRETTY_FUNCTION__);
+}
 
-	// the covariance matrix required by the algorithm
-	Matrix<float64_t> cov;
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::~Evaluation()
+{
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+const Eigen::Ref<const Matrix<float64_t>> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::get_train_cov()
+{
+	if (!has_train_cov)
+	{
+		logger.write(MemDebug, "Before initialization, cov.data = %p\n", train_cov.data());
+
+		// the training data is only needed for its covariance, which is accumulated
+		// while streaming the examples so that the data is never held in memory
+		{
+			// read training data
+			DataGenerator gen(DataSet::feat_train, DataSet::label_train);
+			gen.set_seed(seed);
+			gen.set_num_examples(num_examples);
+
+			if (cache_dir.empty())
+			{
+				gen.generate_cov(train_cov);
+			}
+			else
+			{
+				// the matrix stays in the mapped file instead of being copied
+				train_cache.reset(new CovarianceCache(
+							CovarianceCache::get_filename(cache_dir, gen.get_cov_key())));
+				gen.generate_cov(*train_cache);
+			}
+		}
+
+		has_train_cov = true;
+	}
+
+	if (train_cache)
+		return train_cache->get_cov();
+
+	logger.write(MemDebug, "After initialization, cov.data = %p\n", train_cov.data());
+	logger.write(MemDebug, "After initialization, cov.rows = %u\n", train_cov.rows());
+	logger.write(MemDebug, "After initialization, cov.cols = %u\n", train_cov.cols());
+
+	return train_cov;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+const DataGenerator& Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::get_test_data()
+{
+	if (!test_data)
+	{
+		// read test data
+		test_data.reset(new DataGenerator(DataSet::feat_test, DataSet::label_test));
+		test_data->set_seed(seed);
+		test_data->set_num_examples(num_examples);
+		test_data->generate();
+	}
 
-	logger.write(MemDebug, "Before initialization, cov.data = %p\n", cov.data());
+	return *test_data;
+}
 
-	// data generator is in the block because its destruction frees the
-	// memory holding the dataset
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+const Matrix<float64_t>& Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::get_test_gram()
+{
+	if (!has_test_gram)
 	{
-		// read training data
-		DataGenerator gen(DataSet::feat_train, DataSet::label_train);
-		gen.set_seed(seed);
-		gen.set_num_examples(num_examples);
-		gen.generate();
-		cov = gen.get_cov();
+		get_test_data().get_cov(test_gram);
+		has_test_gram = true;
 	}
 
-	logger.write(MemDebug, "After initialization, cov.data = %p\n", cov.data());
-	logger.write(MemDebug, "After initialization, cov.rows = %u\n", cov.rows());
-	logger.write(MemDebug, "After initialization, cov.cols = %u\n", cov.cols());
+	return test_gram;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::clear_data()
+{
+	train_cov.resize(0, 0);
+	train_cache.reset();
+	has_train_cov = false;
+	test_data.reset();
+	test_gram.resize(0, 0);
+	has_test_gram = false;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+std::vector<index_t> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::train()
+{
+	logger.write(Debug, "%s: Entering!\n", __PRETTY_FUNCTION__);
+
+	// the covariance matrix required by the algorithm
+	const Eigen::Ref<const Matrix<float64_t>> cov = get_train_cov();
 
 	// only cov matrix is in memory
 
@@ -91,43 +237,48 @@ std::pair<index_t,float64_t> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMea
 {
 	logger.write(Debug, "%s: Entering!\n", __PRETTY_FUNCTION__);
 
-	// read test data
-	DataGenerator gen(DataSet::feat_test, DataSet::label_test);
-	gen.set_seed(seed);
-	gen.set_num_examples(num_examples);
-	gen.generate();
+	// the test data and its Gram matrix are generated once and shared by the calls
+	const DataGenerator& gen = get_test_data();
+	const Matrix<float64_t>& gram = get_test_gram();
 
-	// copy only selected features
-	auto feats_in_use = Features<float64_t>::copy_feats(gen.get_regressors(), indices);
-	Vector<float64_t> coeff = Vector<float64_t>::Zero(indices.size());
+	float64_t error = test_errors<ErrorMeasure>(gram, gen.get_regressors(), gen.get_regressand(),
+			indices)[0];
 
-	logger.write(MemDebug, "feats_in_use.data = %p\n", feats_in_use.data());
-	logger.write(MemDebug, "feats_in_use.rows = %p\n", feats_in_use.rows());
-	logger.write(MemDebug, "feats_in_use.cols = %p\n", feats_in_use.cols());
+	logger.write(Debug, "%s: Exiting!\n", __PRETTY_FUNCTION__);
 
-	logger.write(MemDebug, "coeff.data = %p\n", coeff.data());
-	logger.write(MemDebug, "coeff.rows = %p\n", coeff.rows());
-	logger.write(MemDebug, "coeff.cols = %p\n", coeff.rows());
+	return std::make_pair(indices.size(), error);
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+std::pair<index_t,float64_t> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::evaluate()
+{
+	return test(train());
+}
+
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+std::vector<std::vector<index_t>> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::train_path(index_t max_feats)
+{
+	logger.write(Debug, "%s: Entering!\n", __PRETTY_FUNCTION__);
 
-	// fit least square on test data for the selected features
-	LeastSquares<float64_t, LS_NORMAL> model;
-	model.solve(feats_in_use, gen.get_regressand(), coeff);
+	// the covariance matrix is shared by all the runs of the sweep
+	const Eigen::Ref<const Matrix<float64_t>> cov = get_train_cov();
 
-	logger.write(MemDebug, "coeff.data = %p\n", coeff.data());
-	logger.write(MemDebug, "coeff.rows = %p\n", coeff.rows());
-	logger.write(MemDebug, "coeff.cols = %p\n", coeff.rows());
+	logger.write(MemDebug, "In %s, max_feats = %u\n", __PRETTY_FUNCTION__, max_feats);
 
-	// compute error measure
-	ErrorMeasure measure;
 	logger.write(Debug, "%s: Exiting!\n", __PRETTY_FUNCTION__);
 
-	return std::make_pair(indices.size(),measure.compute(gen.get_regressand(), feats_in_use*coeff));
+	return SelectionPath<Algorithm>::run(cov, params, max_feats);
 }
 
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
-std::pair<index_t,float64_t> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::evaluate()
+std::vector<std::pair<index_t,float64_t>> Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::evaluate_path(index_t max_feats)
 {
-	return test(train());
+	std::vector<std::pair<index_t,float64_t>> results;
+	for (auto& indices : train_path(max_feats))
+	{
+		results.push_back(test(indices));
+	}
+	return results;
 }
 
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
@@ -140,12 +291,18 @@ void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::set_params(typena
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
 void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::set_seed(int32_t _seed)
 {
+	if (seed != _seed)
+		clear_data();
+
 	seed = _seed;
 }
 
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
 void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::set_num_examples(index_t _num_examples)
 {
+	if (num_examples != _num_examples)
+		clear_data();
+
 	num_examples = _num_examples;
 }
 
@@ -155,6 +312,14 @@ void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::set_target_feats(
 	target_feats = _target_feats;
 }
 
+template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
+void Evaluation<DataSet,DataGenerator,Algorithm,ErrorMeasure>::set_cache_dir(std::string _cache_dir)
+{
+	// the cached data is computed the same way with or without the cache
+	// directory, so it stays valid
+	cache_dir = _cache_dir;
+}
+
 // MNIST dataset
 template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
 		 Dummy,SumSquaredError<float64_t>>;
@@ -224,6 +389,108 @@ template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL
 		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>,
 		 SquaredMultipleCorrelation<float64_t>>;
 
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
 // Housing dataset
 template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
 		 Dummy,SumSquaredError<float64_t>>;
@@ -292,3 +559,105 @@ template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingRead
 template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
 		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>,
 		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<LazyForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<DummyRegularizer,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SmoothedDifferentialEntropy,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 StochasticForwardRegression<SpectralVariance,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<StochasticForwardRegression,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<DummyRegularizer,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SmoothedDifferentialEntropy,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 OrthogonalMatchingPursuit<SpectralVariance,float64_t>,SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SmoothedDifferentialEntropy,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
+
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 SumSquaredError<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 PearsonsCorrelation<float64_t>>;
+template class Evaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<OrthogonalMatchingPursuit,LocalSearch,SpectralVariance,float64_t>,
+		 SquaredMultipleCorrelation<float64_t>>;
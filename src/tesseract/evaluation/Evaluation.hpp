@@ -26,17 +26,61 @@
 #define EVALUATION_H__
 
 #include <tesseract/base/types.h>
+#include <tesseract/io/CovarianceCache.hpp>
+#include <tesseract/regression/LeastSquares.hpp>
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace tesseract
 {
 
+/**
+ * fits least squares on the test data for the selected features, gathering the
+ * normal equations from its Gram matrix, and evaluates the predictions
+ * @param gram the Gram matrix of the test data, with the regressand as the last column
+ * @param regressors the regressors of the test data
+ * @param regressand the regressand of the test data
+ * @param inds the indices of the selected features
+ * @return the value of each of the ErrorMeasures, in their order
+ */
+template <class... ErrorMeasures>
+std::array<float64_t, sizeof...(ErrorMeasures)> test_errors(const Eigen::Ref<const Matrix<float64_t>>& gram,
+		const Eigen::Ref<const Matrix<float64_t>>& regressors,
+		const Eigen::Ref<const Vector<float64_t>>& regressand, const std::vector<index_t>& inds)
+{
+	Vector<float64_t> coeff = Vector<float64_t>::Zero(inds.size());
+	LeastSquares<float64_t, LS_GRAM> model;
+	model.solve(gram, inds, coeff);
+
+	// predictions from the selected features, without copying them
+	Vector<float64_t> Zp = Vector<float64_t>::Zero(regressors.rows());
+	for (index_t j = 0; j < inds.size(); ++j)
+	{
+		Zp += coeff(j) * regressors.col(inds[j]);
+	}
+
+	return {{ ErrorMeasures().compute(regressand, Zp)... }};
+}
+
 /** @brief template class Evaluation which performs the whole training and testing
  * process via evaluate() method.
+ *
+ * The covariance matrix of the training data, the normalized test data and its
+ * Gram matrix are built lazily on first use and kept until the seed or the number of examples
+ * changes, so that repeated evaluations with different target features or params
+ * don't generate the data again.
  */
 template <class DataSet, class DataGenerator, class Algorithm, class ErrorMeasure>
 class Evaluation
 {
 public:
+	/** default constructor */
+	Evaluation();
+
+	/** destructor */
+	~Evaluation();
+
 	/**
 	 * performs training on training dataset as specified
 	 * @return the indices of the selected features
@@ -52,6 +96,25 @@ public:
 	/** @return a pair containing number of features used and error measure based */
 	std::pair<index_t, float64_t> evaluate();
 
+	/**
+	 * performs training on training dataset for every number of target features
+	 * from 1 to max_feats, computing the covariance matrix only once. Forward
+	 * regression is run only once for the whole sweep, either by itself or as
+	 * the first phase of greedy local search
+	 *
+	 * @param max_feats the maximum number of desired features
+	 * @return the indices of the selected features, the k-th entry (0-based)
+	 * being the ones for k + 1 target features
+	 */
+	std::vector<std::vector<index_t>> train_path(index_t max_feats);
+
+	/**
+	 * @param max_feats the maximum number of desired features
+	 * @return pairs containing number of features used and error measure based,
+	 * for every number of target features from 1 to max_feats
+	 */
+	std::vector<std::pair<index_t, float64_t>> evaluate_path(index_t max_feats);
+
 	/** @param _param params to be used by the algorithm */
 	void set_params(typename Algorithm::param_type _params);
 
@@ -66,7 +129,26 @@ public:
 	 */
 	void set_target_feats(index_t _target_feats);
 
+	/** @param _cache_dir the directory in which the covariance matrices of the
+	 * training data are cached between runs (empty disables the cache)
+	 */
+	void set_cache_dir(std::string _cache_dir);
+
 private:
+	/** @return the covariance matrix of the training data, built on first use.
+	 * With a cache directory it's a view of the mapped cache file
+	 */
+	const Eigen::Ref<const Matrix<float64_t>> get_train_cov();
+
+	/** @return the generator holding the test data, built on first use */
+	const DataGenerator& get_test_data();
+
+	/** @return the Gram matrix of the test data, built on first use */
+	const Matrix<float64_t>& get_test_gram();
+
+	/** drops the cached training and test data */
+	void clear_data();
+
 	/** parameters for the training algorithm */
 	typename Algorithm::param_type params;
 
@@ -78,6 +160,27 @@ private:
 
 	/** number of desired features for the feature selection algorithm */
 	index_t target_feats;
+
+	/** directory of the covariance cache */
+	std::string cache_dir;
+
+	/** covariance matrix of the training data, unless it's cached */
+	Matrix<float64_t> train_cov;
+
+	/** cache holding the mapped covariance matrix of the training data */
+	std::unique_ptr<CovarianceCache> train_cache;
+
+	/** whether train_cov or train_cache is built for the current settings */
+	bool has_train_cov;
+
+	/** generator holding the test data for the current settings */
+	std::unique_ptr<DataGenerator> test_data;
+
+	/** Gram matrix of the test data, features and regressand */
+	Matrix<float64_t> test_gram;
+
+	/** whether test_gram is built for the current settings */
+	bool has_test_gram;
 };
 
 }
@@ -0,0 +1,228 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
+#include <tesseract/evaluation/GridEvaluation.hpp>
+#include <tesseract/evaluation/Evaluation.hpp>
+#include <tesseract/evaluation/ResultWriter.hpp>
+#include <tesseract/evaluation/DataSet.hpp>
+#include <tesseract/preprocessor/DataGenerator.hpp>
+#include <tesseract/io/IDX1Reader.hpp>
+#include <tesseract/io/IDX3Reader.hpp>
+#include <tesseract/io/HousingReader.hpp>
+#include <tesseract/io/CovarianceCache.hpp>
+#include <tesseract/normalizer/UnitL2Normalizer.hpp>
+#include <tesseract/errors/SumSquaredError.hpp>
+#include <tesseract/errors/PearsonsCorrelation.hpp>
+#include <tesseract/errors/SquaredMultipleCorrelation.hpp>
+#include <tesseract/algorithm/ForwardRegression.hpp>
+#include <tesseract/algorithm/LocalSearch.hpp>
+#include <tesseract/algorithm/LinearLocalSearch.hpp>
+#include <tesseract/algorithm/GreedyLocalSearch.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+#include <array>
+#include <future>
+#include <memory>
+#include <chrono>
+
+using namespace tesseract;
+
+template <class DataSet, class DataGenerator, class Algorithm>
+GridEvaluation<DataSet,DataGenerator,Algorithm>::GridEvaluation()
+: num_threads(0)
+{
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::run(ResultWriter& writer)
+{
+	logger.write(Debug, "%s: Entering!\n", __PRETTY_FUNCTION__);
+
+	ThreadPool pool(num_threads);
+
+	for (index_t i = 0; i < seeds.size(); ++i)
+	{
+		for (index_t j = 0; j < num_examples.size(); ++j)
+		{
+			// the covariance matrix of the training data is shared by the configurations,
+			// with a cache directory it stays in the mapped cache file
+			Matrix<float64_t> train_cov;
+			std::unique_ptr<CovarianceCache> cache;
+			{
+				DataGenerator gen(DataSet::feat_train, DataSet::label_train);
+				gen.set_seed(seeds[i]);
+				gen.set_num_examples(num_examples[j]);
+
+				if (cache_dir.empty())
+				{
+					gen.generate_cov(train_cov);
+				}
+				else
+				{
+					cache.reset(new CovarianceCache(CovarianceCache::get_filename(cache_dir,
+									gen.get_cov_key())));
+					gen.generate_cov(*cache);
+				}
+			}
+
+			typedef Eigen::Ref<const Matrix<float64_t>> CovRef;
+			const CovRef cov = cache ? CovRef(cache->get_cov()) : CovRef(train_cov);
+
+			// and so is the test data
+			DataGenerator test_gen(DataSet::feat_test, DataSet::label_test);
+			test_gen.set_seed(seeds[i]);
+			test_gen.set_num_examples(num_examples[j]);
+			test_gen.generate();
+
+			const Eigen::Ref<const Matrix<float64_t>> regressors = test_gen.get_regressors();
+			const Eigen::Ref<const Vector<float64_t>> regressand = test_gen.get_regressand();
+
+			// the least squares fits are solved from the Gram matrix of the test data
+			Matrix<float64_t> gram;
+			test_gen.get_cov(gram);
+
+			// submit all the configurations first, then write the results in order
+			// as soon as each of them is done
+			index_t num_configs = params.size() * target_feats.size();
+			std::vector<GridResult> results(num_configs);
+			std::vector<std::future<void>> futures;
+
+			for (index_t c = 0; c < num_configs; ++c)
+			{
+				GridResult& result = results[c];
+				result.seed = seeds[i];
+				result.num_examples = num_examples[j];
+				result.params = labels[c / target_feats.size()];
+				result.target_feats = target_feats[c % target_feats.size()];
+
+				const typename Algorithm::param_type& config_params = params[c / target_feats.size()];
+
+				futures.push_back(pool.submit([&cov, &regressors, &regressand, &gram, &result, &config_params]()
+				{
+					// train
+					Algorithm algo(cov, result.target_feats);
+					algo.set_params(config_params);
+
+					const auto cpu0 = std::chrono::high_resolution_clock::now();
+					auto selected = algo.run();
+					const auto cpu1 = std::chrono::high_resolution_clock::now();
+
+					result.num_feats = selected.second.size();
+					result.value = selected.first;
+					result.train_time = std::chrono::duration<float64_t>(cpu1 - cpu0).count();
+
+					// test: fit least square on test data for the selected features
+					std::array<float64_t, 3> errors = test_errors<SumSquaredError<float64_t>,
+						PearsonsCorrelation<float64_t>, SquaredMultipleCorrelation<float64_t>>(
+								gram, regressors, regressand, selected.second);
+
+					result.sum_squared_error = errors[0];
+					result.pearsons_correlation = errors[1];
+					result.squared_multiple_correlation = errors[2];
+				}));
+			}
+
+			for (index_t c = 0; c < num_configs; ++c)
+			{
+				pool.wait(futures[c]);
+				writer.write(results[c]);
+			}
+		}
+	}
+
+	logger.write(Debug, "%s: Exiting!\n", __PRETTY_FUNCTION__);
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::add_params(typename
+		Algorithm::param_type _params, std::string label)
+{
+	params.push_back(_params);
+	labels.push_back(label);
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::set_seeds(std::vector<int32_t> _seeds)
+{
+	seeds = _seeds;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::set_num_examples(std::vector<index_t> _num_examples)
+{
+	num_examples = _num_examples;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::set_target_feats(std::vector<index_t> _target_feats)
+{
+	target_feats = _target_feats;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::set_num_threads(index_t _num_threads)
+{
+	num_threads = _num_threads;
+}
+
+template <class DataSet, class DataGenerator, class Algorithm>
+void GridEvaluation<DataSet,DataGenerator,Algorithm>::set_cache_dir(std::string _cache_dir)
+{
+	cache_dir = _cache_dir;
+}
+
+// MNIST dataset
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 ForwardRegression<DummyRegularizer,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 ForwardRegression<SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 ForwardRegression<SpectralVariance,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LocalSearch,SpectralVariance,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<MNISTDataSet,DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>>;
+
+// Housing dataset
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 ForwardRegression<DummyRegularizer,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 ForwardRegression<SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 ForwardRegression<SpectralVariance,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LocalSearch,SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LocalSearch,SpectralVariance,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SmoothedDifferentialEntropy,float64_t>>;
+template class GridEvaluation<HousingDataSet,DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>,
+		 GreedyLocalSearch<ForwardRegression,LinearLocalSearch,SpectralVariance,float64_t>>;
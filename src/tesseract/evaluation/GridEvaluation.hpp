@@ -0,0 +1,110 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GRID_EVALUATION_H__
+#define GRID_EVALUATION_H__
+
+#include <tesseract/base/types.h>
+#include <string>
+#include <vector>
+
+namespace tesseract
+{
+
+class ResultWriter;
+
+/** @brief template class GridEvaluation which performs the training and testing
+ * process of Evaluation for every configuration of a grid of seeds, number of
+ * examples, algorithm parameters and number of target features via run() method.
+ *
+ * The covariance matrix of the training data and the test data are generated
+ * once for every seed and number of examples and shared by the configurations
+ * using them, which are executed in parallel. Every configuration is tested with
+ * sum squared error, Pearson's correlation and squared multiple correlation.
+ */
+template <class DataSet, class DataGenerator, class Algorithm>
+class GridEvaluation
+{
+public:
+	/** default constructor */
+	GridEvaluation();
+
+	/**
+	 * runs all the configurations of the grid and writes the results in the
+	 * order of the seeds, number of examples, parameters and number of target
+	 * features, independent of the order in which they finish
+	 * @param writer the writer for the results
+	 */
+	void run(ResultWriter& writer);
+
+	/** @param _params params to be used by the algorithm
+	 * @param label the label of the params in the results
+	 */
+	void add_params(typename Algorithm::param_type _params, std::string label);
+
+	/** @param _seeds seeds to be used for data generation */
+	void set_seeds(std::vector<int32_t> _seeds);
+
+	/** @param _num_examples numbers of examples to be used for the evaluation */
+	void set_num_examples(std::vector<index_t> _num_examples);
+
+	/** @param _target_feats the numbers of desired features for the feature
+	 * selection algorithm
+	 */
+	void set_target_feats(std::vector<index_t> _target_feats);
+
+	/** @param _num_threads number of configurations run in parallel (0 uses all cores) */
+	void set_num_threads(index_t _num_threads);
+
+	/** @param _cache_dir the directory in which the covariance matrices of the
+	 * training data are cached between runs (empty disables the cache)
+	 */
+	void set_cache_dir(std::string _cache_dir);
+
+private:
+	/** parameters for the training algorithm */
+	std::vector<typename Algorithm::param_type> params;
+
+	/** labels of the parameters */
+	std::vector<std::string> labels;
+
+	/** seeds for random number generator for data generation */
+	std::vector<int32_t> seeds;
+
+	/** numbers of examples */
+	std::vector<index_t> num_examples;
+
+	/** numbers of desired features */
+	std::vector<index_t> target_feats;
+
+	/** number of threads */
+	index_t num_threads;
+
+	/** directory of the covariance cache */
+	std::string cache_dir;
+};
+
+}
+
+#endif // GRID_EVALUATION_H__
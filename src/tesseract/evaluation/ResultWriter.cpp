@@ -0,0 +1,144 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/evaluation/ResultWriter.hpp>
+#include <sstream>
+#include <cstdio>
+
+using namespace tesseract;
+
+ResultWriter::ResultWriter(std::ostream& _out, ResultFormat _format)
+: out(_out), format(_format), num_written(0), closed(false)
+{
+}
+
+ResultWriter::~ResultWriter()
+{
+	close();
+}
+
+void ResultWriter::write(const GridResult& result)
+{
+	assert(!closed);
+
+	// doubles are written with enough digits to be read back exactly
+	std::ostringstream line;
+	line.precision(17);
+
+	if (format == CSV)
+	{
+		if (num_written == 0)
+		{
+			line << "seed,num_examples,params,target_feats,num_feats,value,train_time,"
+				<< "sum_squared_error,pearsons_correlation,squared_multiple_correlation\n";
+		}
+
+		line << result.seed << ',' << result.num_examples << ',' << quote(result.params) << ','
+			<< result.target_feats << ',' << result.num_feats << ',' << result.value << ','
+			<< result.train_time << ',' << result.sum_squared_error << ','
+			<< result.pearsons_correlation << ',' << result.squared_multiple_correlation << '\n';
+	}
+	else
+	{
+		line << (num_written == 0 ? "[\n" : ",\n");
+
+		line << "{\"seed\": " << result.seed
+			<< ", \"num_examples\": " << result.num_examples
+			<< ", \"params\": " << quote(result.params)
+			<< ", \"target_feats\": " << result.target_feats
+			<< ", \"num_feats\": " << result.num_feats
+			<< ", \"value\": " << result.value
+			<< ", \"train_time\": " << result.train_time
+			<< ", \"sum_squared_error\": " << result.sum_squared_error
+			<< ", \"pearsons_correlation\": " << result.pearsons_correlation
+			<< ", \"squared_multiple_correlation\": " << result.squared_multiple_correlation << '}';
+	}
+
+	out << line.str();
+
+	// flush so that the results of a long running grid can be followed
+	out.flush();
+	num_written++;
+}
+
+void ResultWriter::close()
+{
+	if (closed)
+		return;
+
+	if (format == JSON)
+	{
+		out << (num_written == 0 ? "[]\n" : "\n]\n");
+		out.flush();
+	}
+
+	closed = true;
+}
+
+std::string ResultWriter::quote(const std::string& str) const
+{
+	if (format == CSV)
+	{
+		// only fields with separators, quotes or line breaks need quoting
+		if (str.find_first_of(",\"\r\n") == std::string::npos)
+			return str;
+
+		std::string quoted = "\"";
+		for (char c : str)
+		{
+			if (c == '"')
+				quoted += '"';
+			quoted += c;
+		}
+		return quoted + "\"";
+	}
+
+	// all the control characters need to be escaped in JSON strings
+	std::string quoted = "\"";
+	for (char c : str)
+	{
+		switch (c)
+		{
+		case '"': quoted += "\\\""; break;
+		case '\\': quoted += "\\\\"; break;
+		case '\b': quoted += "\\b"; break;
+		case '\f': quoted += "\\f"; break;
+		case '\n': quoted += "\\n"; break;
+		case '\r': quoted += "\\r"; break;
+		case '\t': quoted += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20)
+			{
+				char escaped[7];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+				quoted += escaped;
+			}
+			else
+			{
+				quoted += c;
+			}
+		}
+	}
+	return quoted + "\"";
+}
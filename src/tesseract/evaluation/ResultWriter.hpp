@@ -0,0 +1,119 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef RESULT_WRITER_H__
+#define RESULT_WRITER_H__
+
+#include <tesseract/base/types.h>
+#include <ostream>
+#include <string>
+
+namespace tesseract
+{
+
+/** @brief the formats supported by ResultWriter */
+enum ResultFormat
+{
+	/** comma separated values with a header line */
+	CSV,
+	/** an array of JSON objects */
+	JSON
+};
+
+/** @brief struct GridResult for the result of one configuration of a grid evaluation */
+struct GridResult
+{
+	/** seed used for data generation */
+	int32_t seed;
+
+	/** number of examples used for the evaluation */
+	index_t num_examples;
+
+	/** label of the parameters of the algorithm */
+	std::string params;
+
+	/** number of desired features */
+	index_t target_feats;
+
+	/** number of features selected by the algorithm */
+	index_t num_feats;
+
+	/** function value found by the algorithm */
+	float64_t value;
+
+	/** wall time for training in seconds */
+	float64_t train_time;
+
+	/** sum squared error on the test data */
+	float64_t sum_squared_error;
+
+	/** Pearson's correlation on the test data */
+	float64_t pearsons_correlation;
+
+	/** squared multiple correlation (R^2 statistic) on the test data */
+	float64_t squared_multiple_correlation;
+};
+
+/** @brief class ResultWriter which streams the results of a grid evaluation to
+ * an output stream in CSV or JSON format, one result at a time and in the order
+ * in which they are written
+ */
+class ResultWriter
+{
+public:
+	/** constructor
+	 * @param _out the output stream
+	 * @param _format the output format
+	 */
+	ResultWriter(std::ostream& _out, ResultFormat _format = CSV);
+
+	/** destructor, closes the writer */
+	~ResultWriter();
+
+	/** @param result the result to be written */
+	void write(const GridResult& result);
+
+	/** finishes the output, nothing can be written afterwards */
+	void close();
+
+private:
+	/** @return the string quoted for the output format */
+	std::string quote(const std::string& str) const;
+
+	/** the output stream */
+	std::ostream& out;
+
+	/** the output format */
+	ResultFormat format;
+
+	/** number of results written so far */
+	index_t num_written;
+
+	/** whether the writer was closed */
+	bool closed;
+};
+
+}
+
+#endif // RESULT_WRITER_H__
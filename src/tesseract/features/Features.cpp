@@ -94,3 +94,5 @@ Matrix<T> Features<T>::copy_cov(const Eigen::Ref<const Matrix<T>>& cov, std::vec
 }
 
 template class Features<float64_t>;
+
+template class Features<float32_t>;
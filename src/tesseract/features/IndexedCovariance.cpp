@@ -0,0 +1,97 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/base/init.hpp>
+#include <tesseract/features/IndexedCovariance.hpp>
+
+using namespace tesseract;
+
+template <typename T>
+IndexedCovariance<T>::IndexedCovariance(const Eigen::Ref<const Matrix<T>>& _cov,
+		const std::vector<index_t>& _inds)
+: cov(_cov), inds(_inds)
+{
+	assert(cov.rows() == cov.cols());
+}
+
+template <typename T>
+IndexedCovariance<T>::~IndexedCovariance()
+{
+}
+
+template <typename T>
+index_t IndexedCovariance<T>::rows() const
+{
+	return inds.size();
+}
+
+template <typename T>
+index_t IndexedCovariance<T>::cols() const
+{
+	return inds.size();
+}
+
+template <typename T>
+const std::vector<index_t>& IndexedCovariance<T>::get_inds() const
+{
+	return inds;
+}
+
+template <typename T>
+const Eigen::Ref<const Matrix<T>> IndexedCovariance<T>::gather(Matrix<T>& workspace) const
+{
+	index_t k = inds.size();
+
+	if (workspace.rows() < k || workspace.cols() < k)
+	{
+		logger.write(MemDebug, "growing the workspace to %ux%u!\n", k, k);
+		workspace.resize(k, k);
+	}
+
+	// make use of symmetry
+	for (index_t j = 0; j < k; ++j)
+	{
+		for (index_t i = 0; i < j; ++i)
+		{
+			workspace(i, j) = workspace(j, i) = cov(inds[i], inds[j]);
+		}
+
+		// copy the diagonal
+		workspace(j, j) = cov(inds[j], inds[j]);
+	}
+
+	return workspace.topLeftCorner(k, k);
+}
+
+template <typename T>
+const Eigen::Ref<const Matrix<T>> IndexedCovariance<T>::gather() const
+{
+	static thread_local Matrix<T> workspace;
+	return gather(workspace);
+}
+
+template class IndexedCovariance<float64_t>;
+
+template class IndexedCovariance<float32_t>;
@@ -0,0 +1,95 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef INDEXED_COVARIANCE_H__
+#define INDEXED_COVARIANCE_H__
+
+#include <tesseract/base/types.h>
+#include <vector>
+
+namespace tesseract
+{
+
+/** @brief template class IndexedCovariance for a lightweight view of the
+ * submatrix \f$C_S\f$ of the covariance matrix \f$C\f$ for a set of indices
+ * \f$S\f$. Unlike Features::copy_cov, constructing the view neither allocates
+ * nor sorts the indices. The entries can be accessed directly through the view
+ * or gathered into a reusable workspace whenever a dense matrix is required
+ * (e.g. for a regularizer or the compute function).
+ */
+template <typename T>
+class IndexedCovariance
+{
+public:
+	/** constructor
+	 * @param _cov the whole covariance matrix C
+	 * @param _inds the indices defining the subset S (the view keeps a
+	 * reference, so it must outlive the view)
+	 */
+	IndexedCovariance(const Eigen::Ref<const Matrix<T>>& _cov,
+			const std::vector<index_t>& _inds);
+
+	/** destructor */
+	~IndexedCovariance();
+
+	/** @return the entry \f$C_S(i,j)=C(S_i,S_j)\f$ */
+	inline const T operator()(index_t i, index_t j) const
+	{
+		return cov(inds[i], inds[j]);
+	}
+
+	/** @return the number of rows of \f$C_S\f$ */
+	index_t rows() const;
+
+	/** @return the number of cols of \f$C_S\f$ */
+	index_t cols() const;
+
+	/** @return the indices defining the subset S */
+	const std::vector<index_t>& get_inds() const;
+
+	/** gathers \f$C_S\f$ into the specified workspace, which is only
+	 * reallocated if it is too small
+	 * @param workspace the workspace
+	 * @return the top-left block of the workspace holding \f$C_S\f$
+	 */
+	const Eigen::Ref<const Matrix<T>> gather(Matrix<T>& workspace) const;
+
+	/** gathers \f$C_S\f$ into a workspace owned by the calling thread.
+	 * @return the gathered \f$C_S\f$ which stays valid until the next call to
+	 * this method from the same thread
+	 */
+	const Eigen::Ref<const Matrix<T>> gather() const;
+
+private:
+	/** the whole covariance matrix */
+	const Eigen::Ref<const Matrix<T>> cov;
+
+	/** the indices */
+	const std::vector<index_t>& inds;
+};
+
+}
+
+#endif // INDEXED_COVARIANCE_H__
@@ -0,0 +1,160 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/io/CovarianceCache.hpp>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <functional>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace tesseract;
+
+namespace
+{
+
+/** the magic bytes at the beginning of a cache file */
+const char cache_magic[8] = {'T', 'S', 'R', 'C', 'O', 'V', '\0', '\0'};
+
+}
+
+CovarianceCache::CovarianceCache(std::string _filename)
+: filename(_filename), data(nullptr), dim(0)
+{
+}
+
+CovarianceCache::~CovarianceCache()
+{
+}
+
+bool CovarianceCache::load(const std::string& key)
+{
+	assert(!filename.empty());
+
+	file.reset();
+	data = nullptr;
+	dim = 0;
+
+	// a missing cache isn't an error
+	if (access(filename.c_str(), R_OK) != 0)
+		return false;
+
+	auto cache_file = std::make_shared<const MappedFile>(filename);
+	if (cache_file->size() < sizeof(Header))
+		return false;
+
+	Header header;
+	std::memcpy(&header, cache_file->data(), sizeof(Header));
+
+	// the cache is stale if it was written by another version or for other data
+	if (std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) != 0 ||
+		header.version != version || header.key_length != key.size())
+		return false;
+
+	index_t offset = get_data_offset(header.key_length);
+	if (cache_file->size() != offset + header.dim * header.dim * sizeof(float64_t))
+		return false;
+
+	const char* stored_key = reinterpret_cast<const char*>(cache_file->data() + sizeof(Header));
+	if (key.compare(0, key.size(), stored_key, header.key_length) != 0)
+		return false;
+
+	file = cache_file;
+	data = reinterpret_cast<const float64_t*>(cache_file->data() + offset);
+	dim = header.dim;
+
+	return true;
+}
+
+void CovarianceCache::store(const std::string& key, const Eigen::Ref<const Matrix<float64_t>>& cov) const
+{
+	assert(!filename.empty());
+	assert(cov.rows() == cov.cols());
+
+	Header header;
+	std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+	header.version = version;
+	header.key_length = key.size();
+	header.dim = cov.rows();
+
+	index_t offset = get_data_offset(key.size());
+	std::string padding(offset - sizeof(Header) - key.size(), '\0');
+
+	// write to a temporary file first, so that readers never see a partial cache.
+	// its name is unique, so that concurrent writers of the same cache don't
+	// collide, and it's in the same directory, so that it can be renamed
+	std::vector<char> tmp_filename(filename.begin(), filename.end());
+	const char suffix[] = ".XXXXXX";
+	tmp_filename.insert(tmp_filename.end(), suffix, suffix + sizeof(suffix));
+
+	int fd = mkstemp(tmp_filename.data());
+	if (fd < 0)
+	{
+		std::cerr << "Could not write covariance cache " << filename << std::endl;
+		exit(2);
+	}
+	close(fd);
+
+	std::ofstream os(tmp_filename.data(), std::ios::out | std::ios::binary | std::ios::trunc);
+	os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+	os.write(key.data(), key.size());
+	os.write(padding.data(), padding.size());
+	for (index_t j = 0; j < header.dim; ++j)
+	{
+		// columns are contiguous in memory, but cov may have an outer stride
+		os.write(reinterpret_cast<const char*>(cov.col(j).data()), header.dim * sizeof(float64_t));
+	}
+	os.close();
+
+	if (!os || std::rename(tmp_filename.data(), filename.c_str()) != 0)
+	{
+		std::cerr << "Could not write covariance cache " << filename << std::endl;
+		std::remove(tmp_filename.data());
+		exit(2);
+	}
+}
+
+Eigen::Map<const Matrix<float64_t>> CovarianceCache::get_cov() const
+{
+	assert(file);
+
+	return Eigen::Map<const Matrix<float64_t>>(data, dim, dim);
+}
+
+std::string CovarianceCache::get_filename(std::string dir, const std::string& key)
+{
+	std::ostringstream ss;
+	ss << dir << "/cov_" << std::hex << std::hash<std::string>()(key) << ".bin";
+	return ss.str();
+}
+
+index_t CovarianceCache::get_data_offset(index_t key_length)
+{
+	index_t offset = sizeof(Header) + key_length;
+	return (offset + sizeof(float64_t) - 1) / sizeof(float64_t) * sizeof(float64_t);
+}
@@ -0,0 +1,115 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef COVARIANCE_CACHE_H__
+#define COVARIANCE_CACHE_H__
+
+#include <tesseract/base/types.h>
+#include <tesseract/io/MappedFile.hpp>
+#include <memory>
+#include <string>
+#include <cstdint>
+
+namespace tesseract
+{
+
+/**
+ * @brief class CovarianceCache for storing a computed covariance matrix on disk
+ * and memory mapping it read-only on later runs.
+ *
+ * The file starts with a header (magic, format version, length of the key and
+ * dimension of the matrix), followed by the key and the column-major float64
+ * matrix, aligned to 8 bytes, all in the byte order of the host. The key
+ * describes how the matrix was computed (data set, seed, number of examples,
+ * normalizer, perturbation), a file with a different key or version is stale
+ * and isn't loaded.
+ */
+class CovarianceCache
+{
+public:
+	/** constructor
+	 * @param _filename the filename of the cache
+	 */
+	explicit CovarianceCache(std::string _filename);
+
+	/** destructor */
+	~CovarianceCache();
+
+	/** maps the cache file if it exists and holds the matrix for the key
+	 * @param key the description of the covariance matrix
+	 * @return whether the matrix was loaded
+	 */
+	bool load(const std::string& key);
+
+	/** writes the matrix and the key to the cache file, replacing it atomically
+	 * @param key the description of the covariance matrix
+	 * @param cov the covariance matrix
+	 */
+	void store(const std::string& key, const Eigen::Ref<const Matrix<float64_t>>& cov) const;
+
+	/** @return the loaded covariance matrix, a view into the mapped file */
+	Eigen::Map<const Matrix<float64_t>> get_cov() const;
+
+	/** @return the filename of the cache for the key inside the directory */
+	static std::string get_filename(std::string dir, const std::string& key);
+
+	/** the version of the file format */
+	static const uint32_t version = 1;
+
+private:
+	/** @brief struct Header for the beginning of the cache file */
+	struct Header
+	{
+		/** the magic bytes */
+		char magic[8];
+
+		/** the version of the file format */
+		uint32_t version;
+
+		/** the length of the key */
+		uint32_t key_length;
+
+		/** the number of rows (and columns) of the matrix */
+		uint64_t dim;
+	};
+
+	/** @return the offset of the matrix for a key of specified length */
+	static index_t get_data_offset(index_t key_length);
+
+	/** the filename */
+	std::string filename;
+
+	/** the mapped file */
+	std::shared_ptr<const MappedFile> file;
+
+	/** the loaded matrix inside the mapped file */
+	const float64_t* data;
+
+	/** the number of rows (and columns) of the loaded matrix */
+	index_t dim;
+};
+
+}
+
+#endif // COVARIANCE_CACHE_H__
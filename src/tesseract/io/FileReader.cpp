@@ -26,6 +26,7 @@
 #include <tesseract/io/IDX3Reader.hpp>
 #include <tesseract/io/IDX1Reader.hpp>
 #include <tesseract/io/HousingReader.hpp>
+#include <tesseract/io/TextReader.hpp>
 #include <algorithm>
 #include <map>
 #include <vector>
@@ -33,6 +34,27 @@
 
 using namespace tesseract;
 
+namespace
+{
+
+/** @return the reader of the labels, readers of different types never share a file */
+template <class FeatureReader, class LabelReader>
+LabelReader& select_label_reader(FeatureReader&, LabelReader& label_reader, bool)
+{
+	return label_reader;
+}
+
+/** @return the reader of the labels, which is the one of the features if both
+ * read the same file, so that each record is only parsed once
+ */
+template <class Reader>
+Reader& select_label_reader(Reader& feats_reader, Reader& label_reader, bool same_file)
+{
+	return same_file ? feats_reader : label_reader;
+}
+
+}
+
 template <class FeatureReader, class LabelReader>
 FileReader<FeatureReader, LabelReader>::FileReader()
 {
@@ -53,54 +75,97 @@ template <class FeatureReader, class LabelReader>
 typename FileReader<FeatureReader,LabelReader>::data_type
 FileReader<FeatureReader,LabelReader>::load(int32_t num_examples)
 {
-	// create new feature matrix
-	typename FeatureReader::feat_type features;
-
-	// make sure to use the same indices for labels as well
-	std::vector<int32_t> indices(num_examples);
-
-	// read all the features
+	FeatureReader feats_reader(feats_filename);
+	feats_reader.load_header();
+	assert(feats_reader.get_num_images() >= num_examples);
+
+	LabelReader own_label_reader(labels_filename);
+	LabelReader& label_reader = select_label_reader(feats_reader, own_label_reader,
+			feats_filename == labels_filename);
+	bool shared = &label_reader != &own_label_reader;
+	if (!shared)
+		label_reader.load_header();
+	assert(label_reader.get_num_labels() >= num_examples);
+
+	// generate random problem instance, make sure to use the same indices for labels as well
+	std::vector<int32_t> indices = sample_indices(num_examples, feats_reader.get_num_images());
+
+	// read only the sampled features and labels
+	feats_reader.load(indices);
+	if (!shared)
+		label_reader.load(indices);
+
+	typename FeatureReader::feat_type features(indices.size());
+	typename LabelReader::label_type labels(indices.size());
+	for (index_t i = 0; i < indices.size(); ++i)
 	{
-		FeatureReader feats_reader(feats_filename);
-		feats_reader.load();
+		features[i] = feats_reader.get_image(i);
+		labels[i] = label_reader.get_label(i);
+	}
 
-		assert(feats_reader.get_num_images() >= num_examples);
+	return std::make_pair(features, labels);
+}
 
-		// generate random problem instance
-		std::for_each(indices.begin(), indices.end(), [&feats_reader](int32_t& val)
-		{
-			val = std::rand() % feats_reader.get_num_images();
-		});
+template <class FeatureReader, class LabelReader>
+void FileReader<FeatureReader,LabelReader>::load(int32_t num_examples, index_t chunk_size,
+		std::function<void(const data_type&)> consumer)
+{
+	assert(chunk_size > 0);
 
-		// sort the indices
-		std::sort(indices.begin(), indices.end());
+	FeatureReader feats_reader(feats_filename);
+	feats_reader.load_header();
+	assert(feats_reader.get_num_images() >= num_examples);
 
-		features.resize(indices.size());
-		for (index_t i = 0; i < indices.size(); ++i)
-		{
-			features[i] = feats_reader.get_image(indices[i]);
-		}
-	}
+	LabelReader own_label_reader(labels_filename);
+	LabelReader& label_reader = select_label_reader(feats_reader, own_label_reader,
+			feats_filename == labels_filename);
+	bool shared = &label_reader != &own_label_reader;
+	if (!shared)
+		label_reader.load_header();
+	assert(label_reader.get_num_labels() >= num_examples);
 
-	// create new labels vector
-	typename LabelReader::label_type labels;
+	// generate random problem instance, same as the one of load()
+	std::vector<int32_t> indices = sample_indices(num_examples, feats_reader.get_num_images());
 
-	// read all the labels
+	data_type chunk;
+	for (index_t begin = 0; begin < indices.size(); begin += chunk_size)
 	{
-		LabelReader label_reader(labels_filename);
-		label_reader.load();
+		index_t end = std::min<index_t>(begin + chunk_size, indices.size());
 
-		assert(label_reader.get_num_labels() >= num_examples);
+		// read only the records of this chunk, the slice is still sorted
+		std::vector<int32_t> chunk_indices(indices.begin() + begin, indices.begin() + end);
+		feats_reader.load(chunk_indices);
+		if (!shared)
+			label_reader.load(chunk_indices);
 
-		labels.resize(indices.size());
-		for (index_t i = 0; i < indices.size(); ++i)
+		chunk.first.resize(chunk_indices.size());
+		chunk.second.resize(chunk_indices.size());
+		for (index_t i = 0; i < chunk_indices.size(); ++i)
 		{
-			labels[i] = label_reader.get_label(indices[i]);
+			chunk.first[i] = feats_reader.get_image(i);
+			chunk.second[i] = label_reader.get_label(i);
 		}
+
+		consumer(chunk);
 	}
+}
 
-	return std::make_pair(features, labels);
+template <class FeatureReader, class LabelReader>
+std::vector<int32_t> FileReader<FeatureReader,LabelReader>::sample_indices(int32_t num_examples,
+		int32_t num_images) const
+{
+	std::vector<int32_t> indices(num_examples);
+	std::for_each(indices.begin(), indices.end(), [num_images](int32_t& val)
+	{
+		val = std::rand() % num_images;
+	});
+
+	// sort the indices
+	std::sort(indices.begin(), indices.end());
+
+	return indices;
 }
 
 template class FileReader<IDX3Reader, IDX1Reader>;
 template class FileReader<HousingReader, HousingReader>;
+template class FileReader<TextReader, TextReader>;
@@ -26,6 +26,8 @@
 #define FILE_READER_H__
 
 #include <tesseract/base/types.h>
+#include <vector>
+#include <functional>
 
 namespace tesseract
 {
@@ -61,14 +63,28 @@ public:
 	/** destructor */
 	~FileReader();
 
-	/** loads the images and labels from the specified files
+	/** loads the images and labels from the specified files, reading only
+	 * the sampled records
 	 * @param num_examples specifies the number of the images and labels
 	 * that are used on the learning problem
 	 * @return a pair of feats and labels
 	 */
 	data_type load(int32_t num_examples);
 
+	/** loads the same examples as load() but hands them over in chunks, so
+	 * that the caller never needs to hold all of them at once
+	 * @param num_examples specifies the number of the images and labels
+	 * that are used on the learning problem
+	 * @param chunk_size the maximum number of examples in a chunk
+	 * @param consumer the function to be called with each chunk
+	 */
+	void load(int32_t num_examples, index_t chunk_size,
+			std::function<void(const data_type&)> consumer);
+
 private:
+	/** @return sorted random indices of num_examples examples out of num_images */
+	std::vector<int32_t> sample_indices(int32_t num_examples, int32_t num_images) const;
+
 	/** the feats filename */
 	std::string feats_filename;
 
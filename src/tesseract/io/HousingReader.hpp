@@ -26,30 +26,23 @@
 #define HOUSING_READER_H__
 
 #include <tesseract/base/types.h>
+#include <tesseract/io/TextReader.hpp>
 
 namespace tesseract
 {
 
 /**
- * @brief class HousingReader for reading and storing Bostom housing data
+ * @brief class HousingReader for reading and storing Bostom housing data, a
+ * whitespace delimited text file with the label in the last column
  */
-class HousingReader
+class HousingReader : public TextReader
 {
 public:
 	/** type of Housing features */
-	typedef std::vector<float64_t> HousingFeatures;
-
-	/** type of feature vectors */
-	typedef HousingFeatures vec_type;
+	typedef TextFeatures HousingFeatures;
 
 	/** type of Housing labels */
-	typedef std::vector<float64_t> HousingLabels;
-
-	/** the label type */
-	typedef std::vector<HousingFeatures> feat_type;
-
-	/** the label type */
-	typedef HousingLabels label_type;
+	typedef TextLabels HousingLabels;
 
 	/** default constructor */
 	HousingReader();
@@ -61,31 +54,6 @@ public:
 
 	/** destructor */
 	~HousingReader();
-
-	/** loads the images from the specified file */
-	void load();
-
-	/** @return a reference of the feature vector at specified index */
-	HousingFeatures& get_image(index_t i);
-
-	/** @return the number of feature vectors */
-	int32_t get_num_images();
-
-	/** @return a reference of the image at specified index */
-	float64_t get_label(index_t i);
-
-	/** @return the number of labels */
-	int32_t get_num_labels();
-
-private:
-	/** the filename */
-	std::string filename;
-
-	/** the features array */
-	feat_type feats;
-
-	/** the labels array */
-	label_type labels;
 };
 
 }
@@ -53,11 +53,7 @@ void IDX1Reader::load()
 	if (is.is_open()) {
 
 		// read header info
-		is.read(reinterpret_cast<byte_t*>(&header.magic_number), 4);
-		header.magic_number = be32toh(header.magic_number);
-
-		is.read(reinterpret_cast<byte_t*>(&header.num_labels), 4);
-		header.num_labels = be32toh(header.num_labels);
+		read_header(is);
 
 		// allocate memory
 		int32_t bufsize = header.num_labels;
@@ -78,6 +74,68 @@ void IDX1Reader::load()
 	}
 }
 
+void IDX1Reader::load_header()
+{
+	assert(!filename.empty());
+
+	// the file stays mapped for load(indices), so that it's mapped only once
+	map_file();
+}
+
+void IDX1Reader::load(const std::vector<int32_t>& indices)
+{
+	assert(!filename.empty());
+	assert(std::is_sorted(indices.begin(), indices.end()));
+
+	if (!file)
+		map_file();
+
+	// records are single bytes right after the header
+	const ubyte_t* data = file->data() + 8;
+	labels.resize(indices.size());
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		assert(indices[k] >= 0 && indices[k] < header.num_labels);
+		labels[k] = data[indices[k]];
+	}
+}
+
+void IDX1Reader::map_file()
+{
+	file = std::make_shared<const MappedFile>(filename);
+	const ubyte_t* data = file->data();
+
+	if (file->size() < 8)
+	{
+		std::cerr << "Could not read header of " << filename << std::endl;
+		exit(2);
+	}
+
+	std::copy(data, data + 4, reinterpret_cast<ubyte_t*>(&header.magic_number));
+	header.magic_number = be32toh(header.magic_number);
+	std::copy(data + 4, data + 8, reinterpret_cast<ubyte_t*>(&header.num_labels));
+	header.num_labels = be32toh(header.num_labels);
+
+	if (file->size() < 8 + header.num_labels)
+	{
+		std::cerr << "Invalid IDX1 file " << filename << std::endl;
+		exit(2);
+	}
+}
+
+void IDX1Reader::read_header(std::basic_istream<byte_t>& is)
+{
+	if (!is.read(reinterpret_cast<byte_t*>(&header.magic_number), 4) ||
+		!is.read(reinterpret_cast<byte_t*>(&header.num_labels), 4))
+	{
+		std::cerr << "Could not read header of " << filename << std::endl;
+		exit(2);
+	}
+
+	header.magic_number = be32toh(header.magic_number);
+	header.num_labels = be32toh(header.num_labels);
+}
+
 ubyte_t IDX1Reader::get_label(index_t i)
 {
 	return labels[i];
@@ -26,6 +26,8 @@
 #define IDX1_READER_H__
 
 #include <tesseract/base/types.h>
+#include <tesseract/io/MappedFile.hpp>
+#include <istream>
 
 namespace tesseract
 {
@@ -68,6 +70,18 @@ public:
 	/** loads the images from the specified file */
 	void load();
 
+	/** loads only the header of the specified file, so that the number of
+	 * labels is known before choosing which of them to load. The file stays
+	 * mapped for load(indices)
+	 */
+	void load_header();
+
+	/** loads only the labels at the specified indices, copying them from
+	 * the mapped file. Afterwards get_label(k) returns the label at indices[k]
+	 * @param indices the sorted indices of the labels to be loaded
+	 */
+	void load(const std::vector<int32_t>& indices);
+
 	/** @return a reference of the image at specified index */
 	ubyte_t get_label(index_t i);
 
@@ -75,9 +89,18 @@ public:
 	int32_t get_num_labels();
 
 private:
+	/** reads the header from the beginning of the stream */
+	void read_header(std::basic_istream<byte_t>& is);
+
+	/** maps the file and parses its header */
+	void map_file();
+
 	/** the filename */
 	std::string filename;
 
+	/** the contents of the file, kept from load_header() */
+	std::shared_ptr<const MappedFile> file;
+
 	/** the image header */
 	IDX1Header header;
 
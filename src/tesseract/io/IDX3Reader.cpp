@@ -31,11 +31,12 @@
 
 using namespace tesseract;
 
-IDX3Reader::IDX3Reader()
+IDX3Reader::IDX3Reader() : use_mmap(true)
 {
 }
 
-IDX3Reader::IDX3Reader(std::string _filename) : filename(_filename)
+IDX3Reader::IDX3Reader(std::string _filename, bool _use_mmap)
+: filename(_filename), use_mmap(_use_mmap)
 {
 }
 
@@ -47,48 +48,148 @@ void IDX3Reader::load()
 {
 	assert(!filename.empty());
 
+	map_file();
+
+	// the images are views into the file right after the header
+	const ubyte_t* data = file->data();
+	index_t dim = header.num_rows * header.num_cols;
+	images.resize(header.num_images);
+	for (index_t i = 0; i < header.num_images; ++i)
+	{
+		images[i] = Image(file, data + 16 + i * dim, dim);
+	}
+}
+
+void IDX3Reader::load_header()
+{
+	assert(!filename.empty());
+
+	// a mapped file is kept for load(indices), so that it's mapped only once
+	if (use_mmap)
+	{
+		map_file();
+		return;
+	}
+
 	std::basic_ifstream<byte_t> is;
 	is.open(filename, std::ios::in | std::ios::binary);
+	read_header(is);
+}
 
-	if (is.is_open()) {
+void IDX3Reader::load(const std::vector<int32_t>& indices)
+{
+	assert(!filename.empty());
+	assert(std::is_sorted(indices.begin(), indices.end()));
+
+	images.resize(indices.size());
 
-		// read header info
-		is.read(reinterpret_cast<byte_t*>(&header.magic_number), 4);
-		header.magic_number = be32toh(header.magic_number);
+	// the sampled images are views into the mapped file and aren't copied
+	if (use_mmap)
+	{
+		if (!file)
+			map_file();
 
-		is.read(reinterpret_cast<byte_t*>(&header.num_images), 4);
-		header.num_images = be32toh(header.num_images);
+		index_t dim = header.num_rows * header.num_cols;
+		const ubyte_t* data = file->data();
+		for (index_t k = 0; k < indices.size(); ++k)
+		{
+			assert(indices[k] >= 0 && indices[k] < header.num_images);
+			images[k] = Image(file, data + 16 + indices[k] * dim, dim);
+		}
+		return;
+	}
 
-		is.read(reinterpret_cast<byte_t*>(&header.num_rows), 4);
-		header.num_rows = be32toh(header.num_rows);
-		is.read(reinterpret_cast<byte_t*>(&header.num_cols), 4);
-		header.num_cols = be32toh(header.num_cols);
+	std::basic_ifstream<byte_t> is;
+	is.open(filename, std::ios::in | std::ios::binary);
+	read_header(is);
+	index_t dim = header.num_rows * header.num_cols;
+
+	// otherwise a single buffer holds each distinct record once, the images
+	// are views into it
+	std::vector<int32_t> records;
+	records.reserve(indices.size());
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		assert(indices[k] >= 0 && indices[k] < header.num_images);
+		if (k == 0 || indices[k] != indices[k-1])
+			records.push_back(indices[k]);
+	}
 
-		// allocate memory
-		int32_t dim = header.num_rows * header.num_cols;
-		int32_t bufsize = header.num_images * dim;
-		byte_t *buffer = new byte_t[bufsize];
+	auto buffer = std::make_shared<std::vector<ubyte_t> >(records.size() * dim);
 
-		images.resize(header.num_images);
-		std::for_each(images.begin(), images.end(), [&dim](decltype(images[0]) img)
-		{
-			img.resize(dim);
-		});
+	// runs of consecutive records are contiguous in the file and in the
+	// buffer, so each run takes a single seek and read
+	index_t begin = 0;
+	while (begin < records.size())
+	{
+		index_t end = begin + 1;
+		while (end < records.size() && records[end] == records[end-1] + 1)
+			++end;
 
-		// read the images
-		is.read(buffer, bufsize);
-		for (index_t i = 0; i < header.num_images; ++i)
+		is.seekg(16 + static_cast<std::streamoff>(records[begin]) * dim);
+		if (!is.read(reinterpret_cast<byte_t*>(buffer->data() + begin * dim), (end - begin) * dim))
 		{
-			std::copy(buffer + i*dim, buffer + (i+1)*dim, images[i].begin());
+			std::cerr << "Invalid IDX3 file " << filename << std::endl;
+			exit(2);
 		}
+		begin = end;
+	}
+
+	const ubyte_t* record = buffer->data();
+	for (index_t k = 0; k < indices.size(); ++k)
+	{
+		if (k > 0 && indices[k] != indices[k-1])
+			record += dim;
+		images[k] = Image(buffer, record, dim);
+	}
+}
+
+void IDX3Reader::map_file()
+{
+	file = std::make_shared<const MappedFile>(filename, use_mmap);
+	const ubyte_t* data = file->data();
+
+	if (file->size() < 16)
+	{
+		std::cerr << "Invalid IDX3 file " << filename << std::endl;
+		exit(2);
+	}
+
+	// read header info
+	parse_header(data);
 
-		is.close();
+	index_t dim = header.num_rows * header.num_cols;
+	if (file->size() < 16 + header.num_images * dim)
+	{
+		std::cerr << "Invalid IDX3 file " << filename << std::endl;
+		exit(2);
+	}
+}
 
-		delete [] buffer;
-	} else {
-		std::cerr << "Could not open file " << filename << std::endl;
+void IDX3Reader::read_header(std::basic_istream<byte_t>& is)
+{
+	ubyte_t data[16];
+	if (!is.read(reinterpret_cast<byte_t*>(data), 16))
+	{
+		std::cerr << "Could not read header of " << filename << std::endl;
 		exit(2);
 	}
+
+	parse_header(data);
+}
+
+void IDX3Reader::parse_header(const ubyte_t* data)
+{
+	std::copy(data, data + 4, reinterpret_cast<ubyte_t*>(&header.magic_number));
+	header.magic_number = be32toh(header.magic_number);
+
+	std::copy(data + 4, data + 8, reinterpret_cast<ubyte_t*>(&header.num_images));
+	header.num_images = be32toh(header.num_images);
+
+	std::copy(data + 8, data + 12, reinterpret_cast<ubyte_t*>(&header.num_rows));
+	header.num_rows = be32toh(header.num_rows);
+	std::copy(data + 12, data + 16, reinterpret_cast<ubyte_t*>(&header.num_cols));
+	header.num_cols = be32toh(header.num_cols);
 }
 
 IDX3Reader::Image& IDX3Reader::get_image(index_t i)
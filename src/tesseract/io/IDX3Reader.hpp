@@ -26,6 +26,8 @@
 #define IDX3_READER_H__
 
 #include <tesseract/base/types.h>
+#include <tesseract/io/MappedFile.hpp>
+#include <istream>
 
 namespace tesseract
 {
@@ -54,8 +56,8 @@ struct IDX3Header
 class IDX3Reader
 {
 public:
-	/** type of IDX3 images */
-	typedef std::vector<ubyte_t> Image;
+	/** type of IDX3 images, a view into the (mapped) file */
+	typedef MappedArray<ubyte_t> Image;
 
 	/** type of feature vector */
 	typedef Image vec_type;
@@ -71,15 +73,32 @@ public:
 
 	/** constructor
 	 * @param _filename the filename
+	 * @param _use_mmap whether the file should be memory mapped (otherwise it
+	 * is read into a single buffer)
 	 */
-	explicit IDX3Reader(std::string _filename);
+	explicit IDX3Reader(std::string _filename, bool _use_mmap = true);
 
 	/** destructor */
 	~IDX3Reader();
 
-	/** loads the images from the specified file */
+	/** loads the images from the specified file, the images are views into
+	 * the file and aren't copied
+	 */
 	void load();
 
+	/** loads only the header of the specified file, so that the number of
+	 * images is known before choosing which of them to load. A memory mapped
+	 * file stays mapped for load(indices)
+	 */
+	void load_header();
+
+	/** loads only the images at the specified indices. They are views into
+	 * the mapped file, otherwise each run of consecutive records is read at
+	 * once. Afterwards get_image(k) returns the image at indices[k]
+	 * @param indices the sorted indices of the images to be loaded
+	 */
+	void load(const std::vector<int32_t>& indices);
+
 	/** @return a reference of the image at specified index */
 	Image& get_image(index_t i);
 
@@ -93,9 +112,24 @@ public:
 	int32_t get_num_cols();
 
 private:
+	/** reads and parses the header from the beginning of the stream */
+	void read_header(std::basic_istream<byte_t>& is);
+
+	/** parses the header from the first 16 bytes of the file */
+	void parse_header(const ubyte_t* data);
+
+	/** maps the file and parses its header */
+	void map_file();
+
 	/** the filename */
 	std::string filename;
 
+	/** whether the file should be memory mapped */
+	bool use_mmap;
+
+	/** the contents of the file */
+	std::shared_ptr<const MappedFile> file;
+
 	/** the image header */
 	IDX3Header header;
 
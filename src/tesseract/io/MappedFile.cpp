@@ -0,0 +1,98 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/io/MappedFile.hpp>
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace tesseract;
+
+MappedFile::MappedFile(std::string filename, bool use_mmap)
+: ptr(nullptr), len(0), mapped(false)
+{
+	assert(!filename.empty());
+
+	int fd = open(filename.c_str(), O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0)
+	{
+		std::cerr << "Could not open file " << filename << std::endl;
+		exit(2);
+	}
+	len = st.st_size;
+
+	if (use_mmap && len > 0)
+	{
+		void* addr = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr != MAP_FAILED)
+		{
+			ptr = static_cast<const ubyte_t*>(addr);
+			mapped = true;
+		}
+	}
+	close(fd);
+
+	// fall back to reading the whole file at once
+	if (!mapped)
+	{
+		std::basic_ifstream<byte_t> is(filename, std::ios::in | std::ios::binary);
+		buffer.resize(len);
+		is.read(reinterpret_cast<byte_t*>(buffer.data()), len);
+		if (!is)
+		{
+			std::cerr << "Could not read file " << filename << std::endl;
+			exit(2);
+		}
+		ptr = buffer.data();
+	}
+}
+
+MappedFile::~MappedFile()
+{
+	if (mapped)
+	{
+		munmap(const_cast<ubyte_t*>(ptr), len);
+	}
+}
+
+const ubyte_t* MappedFile::data() const
+{
+	return ptr;
+}
+
+index_t MappedFile::size() const
+{
+	return len;
+}
+
+bool MappedFile::is_mapped() const
+{
+	return mapped;
+}
@@ -0,0 +1,153 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef MAPPED_FILE_H__
+#define MAPPED_FILE_H__
+
+#include <tesseract/base/types.h>
+#include <memory>
+#include <vector>
+
+namespace tesseract
+{
+
+/**
+ * @brief class MappedFile for read-only access to the whole contents of a file.
+ * The file is memory mapped if possible, otherwise it is read into a single
+ * buffer.
+ */
+class MappedFile
+{
+public:
+	/** constructor
+	 * @param filename the filename
+	 * @param use_mmap whether the file should be memory mapped
+	 */
+	explicit MappedFile(std::string filename, bool use_mmap = true);
+
+	/** destructor, unmaps the file */
+	~MappedFile();
+
+	/** @return the pointer to the contents of the file */
+	const ubyte_t* data() const;
+
+	/** @return the size of the file in bytes */
+	index_t size() const;
+
+	/** @return whether the file is memory mapped */
+	bool is_mapped() const;
+
+private:
+	/** not copyable */
+	MappedFile(const MappedFile&);
+
+	/** not copyable */
+	MappedFile& operator=(const MappedFile&);
+
+	/** the pointer to the contents */
+	const ubyte_t* ptr;
+
+	/** the size of the file */
+	index_t len;
+
+	/** whether the file is memory mapped */
+	bool mapped;
+
+	/** the contents when the file isn't mapped */
+	std::vector<ubyte_t> buffer;
+};
+
+/**
+ * @brief template class MappedArray for a read-only array inside a MappedFile
+ * (or any other buffer). It shares the ownership of the storage, so it stays
+ * valid after the reader which created it is gone, and copying it never copies
+ * the contents.
+ */
+template <typename T>
+class MappedArray
+{
+public:
+	/** iterator type */
+	typedef const T* const_iterator;
+
+	/** default constructor */
+	MappedArray() : ptr(nullptr), len(0)
+	{
+	}
+
+	/** constructor
+	 * @param _owner the owner of the storage holding the array
+	 * @param _ptr the pointer to the first element
+	 * @param _len the number of elements
+	 */
+	MappedArray(std::shared_ptr<const void> _owner, const T* _ptr, index_t _len)
+	: owner(_owner), ptr(_ptr), len(_len)
+	{
+	}
+
+	/** @return the number of elements */
+	index_t size() const
+	{
+		return len;
+	}
+
+	/** @return the element at specified index */
+	const T& operator[](index_t i) const
+	{
+		return ptr[i];
+	}
+
+	/** @return the pointer to the first element */
+	const T* data() const
+	{
+		return ptr;
+	}
+
+	/** @return the iterator to the first element */
+	const_iterator begin() const
+	{
+		return ptr;
+	}
+
+	/** @return the iterator past the last element */
+	const_iterator end() const
+	{
+		return ptr + len;
+	}
+
+private:
+	/** the owner of the storage holding the array */
+	std::shared_ptr<const void> owner;
+
+	/** the pointer to the first element */
+	const T* ptr;
+
+	/** the number of elements */
+	index_t len;
+};
+
+}
+
+#endif // MAPPED_FILE_H__
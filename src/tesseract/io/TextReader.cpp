@@ -0,0 +1,465 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <tesseract/io/TextReader.hpp>
+#include <tesseract/io/MappedFile.hpp>
+#include <tesseract/base/ThreadPool.hpp>
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace tesseract;
+
+namespace
+{
+
+/** @return whether c separates two values of a line */
+inline bool is_separator(char c)
+{
+	return c == ' ' || c == '\t' || c == ',' || c == ';' || c == '\r';
+}
+
+/** @brief struct ParsedChunk for the values of a chunk of lines */
+struct ParsedChunk
+{
+	/** the values of all the lines, row-wise */
+	std::vector<float64_t> values;
+
+	/** the number of (non-empty) lines */
+	index_t num_rows = 0;
+
+	/** the number of values on each line */
+	index_t num_cols = 0;
+
+	/** whether all the lines were valid */
+	bool valid = true;
+};
+
+/** parses the lines in [first,last) into chunk */
+void parse_lines(const char* first, const char* last, ParsedChunk& chunk)
+{
+	while (first < last)
+	{
+		const char* eol = std::find(first, last, '\n');
+
+		index_t num_values = 0;
+		const char* p = first;
+		while (true)
+		{
+			while (p < eol && is_separator(*p))
+				++p;
+			if (p == eol)
+				break;
+
+			float64_t value;
+			if (!TextReader::parse_float(p, eol, value) || (p < eol && !is_separator(*p)))
+			{
+				chunk.valid = false;
+				return;
+			}
+
+			chunk.values.push_back(value);
+			num_values++;
+		}
+
+		// skip empty lines, all the others need the same number of values
+		if (num_values > 0)
+		{
+			if (chunk.num_rows == 0)
+			{
+				chunk.num_cols = num_values;
+			}
+			else if (num_values != chunk.num_cols)
+			{
+				chunk.valid = false;
+				return;
+			}
+			chunk.num_rows++;
+		}
+
+		first = eol == last ? last : eol + 1;
+	}
+}
+
+/** @return whether the line [first,eol) holds no values */
+inline bool is_empty_line(const char* first, const char* eol)
+{
+	return std::find_if_not(first, eol, is_separator) == eol;
+}
+
+/** @return the bounds of num_chunks chunks of whole lines of the text */
+std::vector<index_t> split_lines(const char* text, index_t len, index_t num_chunks)
+{
+	std::vector<index_t> bounds(num_chunks + 1, len);
+	bounds[0] = 0;
+	for (index_t c = 1; c < num_chunks; ++c)
+	{
+		index_t pos = std::max(bounds[c-1], c * len / num_chunks);
+		if (pos > 0)
+		{
+			pos = std::find(text + pos - 1, text + len, '\n') - text;
+			pos = std::min(pos + 1, len);
+		}
+		bounds[c] = pos;
+	}
+	return bounds;
+}
+
+/** appends the offsets of the non-empty lines in [begin,end) of the text */
+void find_lines(const char* text, index_t begin, index_t end, std::vector<index_t>& offsets)
+{
+	const char* first = text + begin;
+	const char* last = text + end;
+	while (first < last)
+	{
+		const char* eol = std::find(first, last, '\n');
+		if (!is_empty_line(first, eol))
+			offsets.push_back(first - text);
+		first = eol == last ? last : eol + 1;
+	}
+}
+
+}
+
+TextReader::TextReader() : num_threads(0), num_features(0), num_images(0)
+{
+}
+
+TextReader::TextReader(std::string _filename, index_t _num_threads)
+: filename(_filename), num_threads(_num_threads), num_features(0), num_images(0)
+{
+}
+
+TextReader::~TextReader()
+{
+}
+
+void TextReader::load()
+{
+	assert(!filename.empty());
+
+	MappedFile contents(filename);
+	const char* text = reinterpret_cast<const char*>(contents.data());
+	index_t len = contents.size();
+
+	ThreadPool& threads = get_pool();
+	index_t num_chunks = threads.get_num_threads();
+
+	// split the file into chunks of whole lines
+	std::vector<index_t> bounds = split_lines(text, len, num_chunks);
+
+	std::vector<ParsedChunk> chunks(num_chunks);
+	threads.parallel_for(num_chunks, [&](index_t, index_t begin, index_t end)
+	{
+		for (index_t c = begin; c < end; ++c)
+		{
+			parse_lines(text + bounds[c], text + bounds[c+1], chunks[c]);
+		}
+	});
+
+	// all the chunks need to agree on the number of values per line
+	index_t num_rows = 0;
+	index_t num_cols = 0;
+	bool valid = true;
+	std::vector<index_t> offsets(num_chunks);
+	for (index_t c = 0; c < num_chunks; ++c)
+	{
+		valid &= chunks[c].valid;
+		if (chunks[c].num_rows > 0)
+		{
+			valid &= num_cols == 0 || num_cols == chunks[c].num_cols;
+			num_cols = chunks[c].num_cols;
+		}
+		offsets[c] = num_rows;
+		num_rows += chunks[c].num_rows;
+	}
+
+	if (!valid)
+	{
+		std::cerr << "Invalid text file " << filename << std::endl;
+		exit(2);
+	}
+
+	// the last value of each line is the label
+	num_features = num_cols > 0 ? num_cols - 1 : 0;
+	num_images = num_rows;
+	feats.resize(num_rows);
+	labels.resize(num_rows);
+
+	threads.parallel_for(num_chunks, [&](index_t, index_t begin, index_t end)
+	{
+		for (index_t c = begin; c < end; ++c)
+		{
+			const float64_t* values = chunks[c].values.data();
+			for (index_t i = 0; i < chunks[c].num_rows; ++i, values += num_cols)
+			{
+				feats[offsets[c] + i].assign(values, values + num_features);
+				labels[offsets[c] + i] = values[num_features];
+			}
+		}
+	});
+}
+
+void TextReader::load_header()
+{
+	assert(!filename.empty());
+
+	file = std::shared_ptr<const MappedFile>(new MappedFile(filename));
+	const char* text = reinterpret_cast<const char*>(file->data());
+	index_t len = file->size();
+
+	// only the beginnings of the lines are stored, none of their values
+	ThreadPool& threads = get_pool();
+	index_t num_chunks = threads.get_num_threads();
+	std::vector<index_t> bounds = split_lines(text, len, num_chunks);
+
+	std::vector<std::vector<index_t>> chunk_offsets(num_chunks);
+	threads.parallel_for(num_chunks, [&](index_t, index_t begin, index_t end)
+	{
+		for (index_t c = begin; c < end; ++c)
+		{
+			find_lines(text, bounds[c], bounds[c+1], chunk_offsets[c]);
+		}
+	});
+
+	line_offsets.clear();
+	for (index_t c = 0; c < num_chunks; ++c)
+	{
+		line_offsets.insert(line_offsets.end(), chunk_offsets[c].begin(), chunk_offsets[c].end());
+	}
+	num_images = line_offsets.size();
+
+	// the number of features is given by the first non-empty line
+	ParsedChunk first_line;
+	if (!line_offsets.empty())
+	{
+		const char* first = text + line_offsets[0];
+		parse_lines(first, std::find(first, text + len, '\n'), first_line);
+	}
+
+	if (!first_line.valid)
+	{
+		std::cerr << "Invalid text file " << filename << std::endl;
+		exit(2);
+	}
+
+	num_features = first_line.num_cols > 0 ? first_line.num_cols - 1 : 0;
+	feats.clear();
+	labels.clear();
+}
+
+void TextReader::load(const std::vector<int32_t>& indices)
+{
+	assert(std::is_sorted(indices.begin(), indices.end()));
+
+	if (!file)
+		load_header();
+
+	assert(indices.empty() || (indices.front() >= 0 && indices.back() < line_offsets.size()));
+
+	const char* text = reinterpret_cast<const char*>(file->data());
+	const char* last = text + file->size();
+
+	feats.resize(indices.size());
+	labels.resize(indices.size());
+
+	// only the selected lines are parsed, each of them needs as many values
+	// as the first line of the file
+	ThreadPool& threads = get_pool();
+	std::vector<ParsedChunk> chunks(threads.get_num_threads());
+	threads.parallel_for(indices.size(), [&](index_t c, index_t begin, index_t end)
+	{
+		ParsedChunk& line = chunks[c];
+		for (index_t k = begin; k < end && line.valid; ++k)
+		{
+			if (k > begin && indices[k] == indices[k-1])
+			{
+				feats[k] = feats[k-1];
+				labels[k] = labels[k-1];
+				continue;
+			}
+
+			const char* first = text + line_offsets[indices[k]];
+			line.values.clear();
+			line.num_rows = 0;
+			parse_lines(first, std::find(first, last, '\n'), line);
+			if (!line.valid || line.num_cols != num_features + 1)
+			{
+				line.valid = false;
+				break;
+			}
+
+			const float64_t* values = line.values.data();
+			feats[k].assign(values, values + num_features);
+			labels[k] = values[num_features];
+		}
+	});
+
+	for (index_t c = 0; c < chunks.size(); ++c)
+	{
+		if (!chunks[c].valid)
+		{
+			std::cerr << "Invalid text file " << filename << std::endl;
+			exit(2);
+		}
+	}
+
+	num_images = indices.size();
+}
+
+ThreadPool& TextReader::get_pool()
+{
+	if (!pool)
+		pool = std::make_shared<ThreadPool>(num_threads);
+	return *pool;
+}
+
+TextReader::TextFeatures& TextReader::get_image(index_t i)
+{
+	return feats[i];
+}
+
+int32_t TextReader::get_num_images()
+{
+	return num_images;
+}
+
+float64_t TextReader::get_label(index_t i)
+{
+	return labels[i];
+}
+
+int32_t TextReader::get_num_labels()
+{
+	return num_images;
+}
+
+int32_t TextReader::get_num_features()
+{
+	return num_features;
+}
+
+bool TextReader::parse_float(const char*& first, const char* last, float64_t& value)
+{
+	// powers of ten which are exactly representable as doubles
+	static const float64_t powers[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	const char* p = first;
+
+	bool negative = false;
+	if (p < last && (*p == '-' || *p == '+'))
+	{
+		negative = *p == '-';
+		++p;
+	}
+
+	// collect up to 19 significant digits, which always fit into 64 bits
+	uint64_t mantissa = 0;
+	int32_t num_digits = 0;
+	int32_t exponent = 0;
+	bool truncated = false;
+	bool found_digits = false;
+
+	for (; p < last && *p >= '0' && *p <= '9'; ++p)
+	{
+		found_digits = true;
+		if (num_digits < 19)
+		{
+			mantissa = mantissa * 10 + (*p - '0');
+			num_digits += mantissa > 0;
+		}
+		else
+		{
+			truncated |= *p != '0';
+			exponent++;
+		}
+	}
+
+	if (p < last && *p == '.')
+	{
+		for (++p; p < last && *p >= '0' && *p <= '9'; ++p)
+		{
+			found_digits = true;
+			if (num_digits < 19)
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+				num_digits += mantissa > 0;
+				exponent--;
+			}
+			else
+			{
+				truncated |= *p != '0';
+			}
+		}
+	}
+
+	if (!found_digits)
+		return false;
+
+	if (p < last && (*p == 'e' || *p == 'E'))
+	{
+		const char* q = p + 1;
+		bool negative_exponent = false;
+		if (q < last && (*q == '-' || *q == '+'))
+		{
+			negative_exponent = *q == '-';
+			++q;
+		}
+
+		if (q == last || *q < '0' || *q > '9')
+			return false;
+
+		int32_t e = 0;
+		for (; q < last && *q >= '0' && *q <= '9'; ++q)
+		{
+			if (e < 100000)
+				e = e * 10 + (*q - '0');
+		}
+
+		exponent += negative_exponent ? -e : e;
+		p = q;
+	}
+
+	if (!truncated && mantissa < (1ull << 53) && exponent >= -22 && exponent <= 22)
+	{
+		// both operands are exact, so the result is correctly rounded
+		value = static_cast<float64_t>(mantissa);
+		value = exponent < 0 ? value / powers[-exponent] : value * powers[exponent];
+		if (negative)
+			value = -value;
+	}
+	else
+	{
+		// the text isn't null terminated, so copy the number for strtod
+		std::string number(first, p);
+		value = std::strtod(number.c_str(), nullptr);
+	}
+
+	first = p;
+	return true;
+}
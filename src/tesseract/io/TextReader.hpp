@@ -0,0 +1,150 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEXT_READER_H__
+#define TEXT_READER_H__
+
+#include <tesseract/base/types.h>
+#include <tesseract/io/MappedFile.hpp>
+#include <memory>
+#include <vector>
+
+namespace tesseract
+{
+
+class ThreadPool;
+
+/**
+ * @brief class TextReader for reading and storing regression data sets in
+ * delimited text files. Each line holds one example, the values are separated
+ * by whitespace, commas or semicolons and the last value of a line is the
+ * label. The number of examples and features is detected from the file, which
+ * is parsed in parallel on chunks of lines.
+ */
+class TextReader
+{
+public:
+	/** type of text features */
+	typedef std::vector<float64_t> TextFeatures;
+
+	/** type of feature vectors */
+	typedef TextFeatures vec_type;
+
+	/** type of text labels */
+	typedef std::vector<float64_t> TextLabels;
+
+	/** the feat type */
+	typedef std::vector<TextFeatures> feat_type;
+
+	/** the label type */
+	typedef TextLabels label_type;
+
+	/** default constructor */
+	TextReader();
+
+	/** constructor
+	 * @param _filename the filename
+	 * @param _num_threads the number of threads for parsing (0 uses all cores)
+	 */
+	explicit TextReader(std::string _filename, index_t _num_threads = 0);
+
+	/** destructor */
+	~TextReader();
+
+	/** loads the features and labels from the specified file */
+	void load();
+
+	/** finds the beginning of each line of the file and counts the values
+	 * of its first line to know the number of feature vectors and features,
+	 * without storing any of them. The file stays mapped for load(indices)
+	 */
+	void load_header();
+
+	/** loads only the lines at the specified indices, using the beginnings
+	 * of the lines found by load_header(). Afterwards get_image(k) and
+	 * get_label(k) return the line at indices[k]
+	 * @param indices the sorted indices of the lines to be loaded
+	 */
+	void load(const std::vector<int32_t>& indices);
+
+	/** @return a reference of the feature vector at specified index */
+	TextFeatures& get_image(index_t i);
+
+	/** @return the number of feature vectors */
+	int32_t get_num_images();
+
+	/** @return the label at specified index */
+	float64_t get_label(index_t i);
+
+	/** @return the number of labels */
+	int32_t get_num_labels();
+
+	/** @return the number of features of each feature vector */
+	int32_t get_num_features();
+
+	/** parses a decimal floating point number (e.g. -1.5e-3). The result is
+	 * the same as of std::strtod, which is only called when the number can't
+	 * be computed exactly from its digits
+	 * @param first the beginning of the number, advanced past it on success
+	 * @param last the end of the text
+	 * @param value the parsed value
+	 * @return whether a number was found at first
+	 */
+	static bool parse_float(const char*& first, const char* last, float64_t& value);
+
+protected:
+	/** @return the threads for parsing */
+	ThreadPool& get_pool();
+
+	/** the filename */
+	std::string filename;
+
+	/** the number of threads */
+	index_t num_threads;
+
+	/** the number of features */
+	index_t num_features;
+
+	/** the number of loaded feature vectors, or of the lines after load_header() */
+	index_t num_images;
+
+	/** the contents of the file, kept from load_header() */
+	std::shared_ptr<const MappedFile> file;
+
+	/** the beginnings of the non-empty lines, found by load_header() */
+	std::vector<index_t> line_offsets;
+
+	/** the threads for parsing, started once per reader */
+	std::shared_ptr<ThreadPool> pool;
+
+	/** the features array */
+	feat_type feats;
+
+	/** the labels array */
+	label_type labels;
+};
+
+}
+
+#endif // TEXT_READER_H__
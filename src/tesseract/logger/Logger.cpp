@@ -66,3 +66,8 @@ void Logger::print_matrix(const Eigen::Ref<const Matrix<float64_t>>& mat)
 {
 	std::cout << "matrix = " << std::endl << mat << std::endl;
 }
+
+void Logger::print_matrix(const Eigen::Ref<const Matrix<float32_t>>& mat)
+{
+	std::cout << "matrix = " << std::endl << mat << std::endl;
+}
@@ -74,6 +74,9 @@ public:
 	/** @param matrix to be printed in stdout */
 	void print_matrix(const Eigen::Ref<const Matrix<float64_t>>& mat);
 
+	/** @param matrix to be printed in stdout */
+	void print_matrix(const Eigen::Ref<const Matrix<float32_t>>& mat);
+
 private:
 	/** log level */
 	LogLevel loglevel;
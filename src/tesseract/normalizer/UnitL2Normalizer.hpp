@@ -47,6 +47,30 @@ struct UnitL2Normalizer
 				samples.col(i).normalize();
 		}
 	}
+
+	/** normalizes a Gram matrix \f$A^TA\f$ (only the lower triangle is used and
+	 * updated) as if the columns of \f$A\f$ had been normalized beforehand,
+	 * i.e. \f$(A^TA)_{ij}/(\|a_i\|\|a_j\|)\f$
+	 * @param gram the Gram matrix which is to be normalized
+	 */
+	void normalize_gram(Container& gram)
+	{
+		// zero columns are left as they are
+		Vector<float64_t> norms = gram.diagonal().cwiseSqrt();
+		for (index_t i = 0; i < norms.rows(); ++i)
+		{
+			if (norms[i] <= std::numeric_limits<float64_t>::epsilon())
+				norms[i] = 1;
+		}
+
+		for (index_t j = 0; j < gram.cols(); ++j)
+		{
+			for (index_t i = j; i < gram.rows(); ++i)
+			{
+				gram(i, j) /= norms[i] * norms[j];
+			}
+		}
+	}
 };
 
 }
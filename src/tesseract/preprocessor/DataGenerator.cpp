@@ -23,21 +23,53 @@
  */
 
 #include <tesseract/base/init.hpp>
+#include <tesseract/base/ThreadPool.hpp>
 #include <tesseract/preprocessor/DataGenerator.hpp>
 #include <tesseract/io/FileReader.hpp>
 #include <tesseract/io/IDX1Reader.hpp>
 #include <tesseract/io/IDX3Reader.hpp>
 #include <tesseract/io/HousingReader.hpp>
+#include <tesseract/io/TextReader.hpp>
+#include <tesseract/io/CovarianceCache.hpp>
 #include <tesseract/normalizer/UnitL2Normalizer.hpp>
+#include <iostream>
 #include <cstdlib>
 #include <random>
+#include <vector>
+#include <algorithm>
 #include <iomanip>
+#include <sstream>
+#include <typeinfo>
+#include <sys/stat.h>
 
 using namespace tesseract;
 
+namespace
+{
+
+/** @return the filename along with the size and modification time of the
+ * file, so that the description changes whenever the file is rewritten
+ */
+std::string describe_file(const std::string& filename)
+{
+	std::ostringstream ss;
+	ss << filename;
+
+	struct stat st;
+	if (stat(filename.c_str(), &st) == 0)
+	{
+		ss << ":" << st.st_size << ":" << st.st_mtim.tv_sec << "." << st.st_mtim.tv_nsec;
+	}
+
+	return ss.str();
+}
+
+}
+
 template <class FeatureReader, class LabelReader, template <class> class Normalizer>
 DataGenerator<FeatureReader,LabelReader,Normalizer>::DataGenerator()
-: perturbation_type(NoPerturbation), sigma(0.1)
+: perturbation_type(NoPerturbation), sigma(0.1), num_threads(1),
+	chunk_size(default_chunk_size)
 {
 }
 
@@ -45,7 +77,8 @@ template <class FeatureReader, class LabelReader, template <class> class Normali
 DataGenerator<FeatureReader,LabelReader,Normalizer>::DataGenerator(std::string feats_file,
 		std::string labels_file)
 	: feats_filename(feats_file), labels_filename(labels_file),
-	perturbation_type(NoPerturbation), sigma(0.1)
+	perturbation_type(NoPerturbation), sigma(0.1), num_threads(1),
+	chunk_size(default_chunk_size)
 {
 }
 
@@ -151,11 +184,180 @@ void DataGenerator<FeatureReader,LabelReader,Normalizer>::perturbate()
 }
 
 template <class FeatureReader, class LabelReader, template <class> class Normalizer>
-const Matrix<float64_t> DataGenerator<FeatureReader,LabelReader,Normalizer>::get_cov() const
+Matrix<float64_t> DataGenerator<FeatureReader,LabelReader,Normalizer>::get_cov() const
+{
+	Matrix<float64_t> cov;
+	get_cov(cov);
+	return cov;
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::get_cov(Matrix<float64_t>& cov) const
 {
 	// compute covariance once and for all
 	// since the data is unit L2 normalized columnwise, the covarience would be A^T A
-	return data.transpose() * data;
+	cov.setZero(data.cols(), data.cols());
+	ThreadPool pool(num_threads);
+	add_gram(pool, data, cov);
+	mirror_lower(pool, cov);
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::generate_cov(Matrix<float64_t>& cov)
+{
+	typedef FileReader<FeatureReader,LabelReader> Reader;
+	typedef typename Reader::feat_type feat_type;
+	typedef typename Reader::label_type label_type;
+	typedef typename Reader::data_type data_type;
+
+	// the noise is added to the normalized data which isn't stored here
+	assert(perturbation_type == NoPerturbation);
+
+	// set seed for random sampling
+	std::srand(seed);
+
+	// only one chunk of the data is in memory at any time, the threads are
+	// shared by all of them
+	Matrix<float64_t> chunk_data;
+	cov.resize(0, 0);
+	ThreadPool pool(num_threads);
+
+	Reader reader(feats_filename, labels_filename);
+	reader.load(num_examples, chunk_size, [&](const data_type& examples)
+	{
+		const feat_type& features = examples.first;
+		const label_type& labels = examples.second;
+
+		// sanity check
+		assert(features.size() > 0);
+		assert(features[0].size() > 0);
+		assert(labels.size() == features.size());
+
+		index_t num_vec = features.size();
+		index_t num_feats = features[0].size();
+
+		if (cov.rows() == 0)
+		{
+			cov.setZero(num_feats + 1, num_feats + 1);
+		}
+
+		// same layout as the data of generate()
+		chunk_data.resize(num_vec, num_feats + 1);
+		for (index_t i = 0; i < num_vec; ++i)
+		{
+			for (index_t j = 0; j < num_feats; ++j)
+			{
+				chunk_data(i, j) = static_cast<float64_t>(features[i][j]);
+			}
+			chunk_data(i, num_feats) = static_cast<float64_t>(labels[i]);
+		}
+
+		add_gram(pool, chunk_data, cov);
+	});
+
+	// normalizing the columns of the data amounts to scaling the Gram matrix
+	Normalizer<Matrix<float64_t>> normalizer;
+	normalizer.normalize_gram(cov);
+
+	mirror_lower(pool, cov);
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::generate_cov(CovarianceCache& cache)
+{
+	std::string key = get_cov_key();
+
+	if (cache.load(key))
+	{
+		logger.write(Debug, "Loaded covariance matrix from the cache\n");
+		return;
+	}
+
+	// the computed matrix is only held until it is stored, then it's mapped
+	{
+		Matrix<float64_t> cov;
+		generate_cov(cov);
+		cache.store(key, cov);
+	}
+
+	if (!cache.load(key))
+	{
+		std::cerr << "Could not map the stored covariance cache" << std::endl;
+		exit(2);
+	}
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+std::string DataGenerator<FeatureReader,LabelReader,Normalizer>::get_cov_key() const
+{
+	std::ostringstream ss;
+	ss << "feats=" << describe_file(feats_filename)
+	   << ";labels=" << describe_file(labels_filename)
+	   << ";seed=" << seed << ";num_examples=" << num_examples
+	   << ";normalizer=" << typeid(Normalizer<Matrix<float64_t>>).name()
+	   << ";perturbation=" << perturbation_type
+	   << ";sigma=" << std::setprecision(17) << sigma;
+	return ss.str();
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::add_gram(ThreadPool& pool,
+		const Eigen::Ref<const Matrix<float64_t>>& A, Matrix<float64_t>& cov) const
+{
+	index_t n = A.cols();
+	assert(cov.rows() == n && cov.cols() == n);
+
+	// the lower triangle is split into blocks of columns, each block (I,J)
+	// with J <= I is an independent task writing its own part of cov
+	const index_t block_size = cov_block_size;
+	index_t num_blocks = (n + block_size - 1) / block_size;
+	std::vector<std::pair<index_t,index_t>> blocks;
+	for (index_t I = 0; I < num_blocks; ++I)
+	{
+		for (index_t J = 0; J <= I; ++J)
+		{
+			blocks.push_back(std::make_pair(I, J));
+		}
+	}
+
+	pool.parallel_for(blocks.size(), [&](index_t, index_t begin, index_t end)
+	{
+		for (index_t b = begin; b < end; ++b)
+		{
+			index_t row = blocks[b].first * block_size;
+			index_t col = blocks[b].second * block_size;
+			index_t rows = std::min(block_size, n - row);
+			index_t cols = std::min(block_size, n - col);
+
+			auto block = cov.block(row, col, rows, cols);
+			if (row == col)
+			{
+				// symmetric rank-k update on the diagonal blocks
+				block.template selfadjointView<Eigen::Lower>().rankUpdate(
+						A.middleCols(row, rows).transpose());
+			}
+			else
+			{
+				block.noalias() += A.middleCols(row, rows).transpose()
+					* A.middleCols(col, cols);
+			}
+		}
+	});
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::mirror_lower(ThreadPool& pool,
+		Matrix<float64_t>& cov) const
+{
+	index_t n = cov.cols();
+
+	pool.parallel_for(n, [&](index_t, index_t begin, index_t end)
+	{
+		for (index_t j = begin; j < end; ++j)
+		{
+			cov.row(j).tail(n - j - 1) = cov.col(j).tail(n - j - 1).transpose();
+		}
+	});
 }
 
 template <class FeatureReader, class LabelReader, template <class> class Normalizer>
@@ -164,6 +366,18 @@ void DataGenerator<FeatureReader,LabelReader,Normalizer>::set_num_examples(int32
 	num_examples = _num_examples;
 }
 
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::set_num_threads(index_t _num_threads)
+{
+	num_threads = _num_threads;
+}
+
+template <class FeatureReader, class LabelReader, template <class> class Normalizer>
+void DataGenerator<FeatureReader,LabelReader,Normalizer>::set_chunk_size(index_t _chunk_size)
+{
+	chunk_size = _chunk_size;
+}
+
 template <class FeatureReader, class LabelReader, template <class> class Normalizer>
 void DataGenerator<FeatureReader,LabelReader,Normalizer>::set_perturbation_type(PerturbationType _perturbation_type)
 {
@@ -204,3 +418,4 @@ const Eigen::Ref<const Vector<float64_t>> DataGenerator<FeatureReader,LabelReade
 
 template class DataGenerator<IDX3Reader,IDX1Reader,UnitL2Normalizer>;
 template class DataGenerator<HousingReader,HousingReader,UnitL2Normalizer>;
+template class DataGenerator<TextReader,TextReader,UnitL2Normalizer>;
@@ -26,10 +26,13 @@
 #define DATA_GENERATOR_H__
 
 #include <tesseract/base/types.h>
+#include <tesseract/io/CovarianceCache.hpp>
 
 namespace tesseract
 {
 
+class ThreadPool;
+
 /** perturbation type */
 enum PerturbationType
 {
@@ -72,6 +75,30 @@ public:
 	 */
 	void generate();
 
+	/** computes the covariance matrix of the normalized data directly while
+	 * reading the examples in chunks, without storing the data (the regressors
+	 * and regressand are not available afterwards). It selects the same
+	 * examples as generate() and perturbation isn't supported.
+	 * @param cov the covariance matrix (resized if necessary)
+	 */
+	void generate_cov(Matrix<float64_t>& cov);
+
+	/** same as generate_cov(cov), but maps the covariance matrix from the
+	 * cache file if it was stored there for the same get_cov_key(), otherwise
+	 * the matrix is computed and stored in the cache file for later runs.
+	 * Afterwards cache.get_cov() is a view of the mapped matrix, which is
+	 * valid as long as the cache
+	 * @param cache the cache of the covariance matrix
+	 */
+	void generate_cov(CovarianceCache& cache);
+
+	/** @return the description of the covariance matrix computed by
+	 * generate_cov() (data set with the size and modification time of its
+	 * files, seed, number of examples, normalizer and perturbation), which
+	 * identifies it in a cache
+	 */
+	std::string get_cov_key() const;
+
 	/** @param _seed for rng */
 	void set_seed(int32_t _seed);
 
@@ -84,11 +111,26 @@ public:
 	/** @param _num_examples the number of examples */
 	void set_num_examples(int32_t _num_examples);
 
+	/** @param _num_threads the number of threads for computing the covariance
+	 * matrix (1 by default, 0 uses all cores)
+	 */
+	void set_num_threads(index_t _num_threads);
+
+	/** @param _chunk_size the number of examples read at once by generate_cov() */
+	void set_chunk_size(index_t _chunk_size);
+
 	/** @return the number of examples */
 	int32_t get_num_examples() const;
 
 	/** @return the covariance matrix on the whole data */
-	const Matrix<float64_t> get_cov() const;
+	Matrix<float64_t> get_cov() const;
+
+	/** computes the covariance matrix on the whole data in place. Only the
+	 * lower triangle is computed, by symmetric rank-k updates on blocks of
+	 * columns in parallel, and then mirrored to the upper triangle.
+	 * @param cov the covariance matrix (resized if necessary)
+	 */
+	void get_cov(Matrix<float64_t>& cov) const;
 
 	/** @return the regressors (real valued dense feature matrix) */
 	const Eigen::Ref<const Matrix<float64_t>> get_regressors() const;
@@ -100,6 +142,17 @@ private:
 	/** perturbate the data */
 	void perturbate();
 
+	/** adds the lower triangle of \f$A^TA\f$ to the lower triangle of cov
+	 * using the threads of pool
+	 */
+	void add_gram(ThreadPool& pool, const Eigen::Ref<const Matrix<float64_t>>& A,
+			Matrix<float64_t>& cov) const;
+
+	/** copies the lower triangle of cov to the upper triangle using the
+	 * threads of pool
+	 */
+	void mirror_lower(ThreadPool& pool, Matrix<float64_t>& cov) const;
+
 	/** the regressors (all but last column) and regressand (last column) */
 	Matrix<float64_t> data;
 
@@ -120,6 +173,18 @@ private:
 
 	/** sigma for the perturbation */
 	float64_t sigma;
+
+	/** number of threads for computing the covariance matrix */
+	index_t num_threads;
+
+	/** number of examples read at once by generate_cov() */
+	index_t chunk_size;
+
+	/** number of columns in a block of the covariance computation */
+	static constexpr index_t cov_block_size = 64;
+
+	/** default number of examples read at once by generate_cov() */
+	static constexpr index_t default_chunk_size = 1024;
 };
 
 }
@@ -31,3 +31,9 @@ using namespace Eigen;
 template class LeastSquares<float64_t, LS_SVD>;
 template class LeastSquares<float64_t, LS_QR>;
 template class LeastSquares<float64_t, LS_NORMAL>;
+template class LeastSquares<float64_t, LS_GRAM>;
+
+template class LeastSquares<float32_t, LS_SVD>;
+template class LeastSquares<float32_t, LS_QR>;
+template class LeastSquares<float32_t, LS_NORMAL>;
+template class LeastSquares<float32_t, LS_GRAM>;
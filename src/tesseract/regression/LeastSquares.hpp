@@ -26,6 +26,7 @@
 #define LEAST_SQUARES_H__
 
 #include <tesseract/base/types.h>
+#include <vector>
 
 namespace tesseract
 {
@@ -38,7 +39,8 @@ enum LeastSquareMethod
 {
 	LS_SVD,
 	LS_QR,
-	LS_NORMAL
+	LS_NORMAL,
+	LS_GRAM
 };
 
 /**
@@ -111,6 +113,45 @@ struct LeastSquares<T, LS_NORMAL>
 	}
 };
 
+/**
+ * @brief template class LeastSquares is the generic class for solving
+ * least square problem for solving over-dertermined system \f$A_Sx=b\f$
+ * using \f$x=(A_S^T.A_S)^{-1}(A_S^T.b)\f$ for a subset \f$S\f$ of the columns
+ * of \f$A\f$, where both the terms are gathered from the precomputed Gram
+ * matrix \f$G=[A\ b]^T[A\ b]\f$, i.e. the covariance matrix with
+ * \f$A^Tb\f$ as the last column. After computing \f$G\f$ once, every
+ * subset is solved in \f$O(|S|^3)\f$ without touching \f$A\f$.
+ */
+template <typename T>
+struct LeastSquares<T, LS_GRAM>
+{
+	/**
+	 * Solves the over-determined system \f$A_Sx=b\f$.
+	 * @param G the Gram matrix \f$G=[A\ b]^T[A\ b]\f$
+	 * @param inds the indices of the columns of \f$A\f$ in \f$S\f$
+	 * @param result result vector \f$x\f$, in the order of inds
+	 */
+	void solve(const Eigen::Ref<const Matrix<T>>& G, const std::vector<index_t>& inds,
+			Eigen::Ref<Vector<T>> result) const
+	{
+		index_t k = inds.size();
+		index_t N = G.cols() - 1;
+		assert(result.rows() == k);
+
+		Matrix<T> G_S(k, k);
+		Vector<T> b_S(k);
+		for (index_t j = 0; j < k; ++j)
+		{
+			assert(inds[j] < N);
+			for (index_t i = 0; i < k; ++i)
+				G_S(i, j) = G(inds[i], inds[j]);
+			b_S(j) = G(inds[j], N);
+		}
+
+		result = G_S.ldlt().solve(b_S);
+	}
+};
+
 }
 
 #endif // LEAST_SQUARES_H__
@@ -38,3 +38,5 @@ void DummyRegularizer<T>::set_params(typename DummyRegularizer<T>::param_type pa
 }
 
 template class DummyRegularizer<float64_t>;
+
+template class DummyRegularizer<float32_t>;
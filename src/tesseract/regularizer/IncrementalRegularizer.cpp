@@ -0,0 +1,419 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <tesseract/regularizer/IncrementalRegularizer.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace tesseract;
+
+template <template <class> class Regularizer, typename T>
+IncrementalRegularizer<Regularizer, T>::IncrementalRegularizer(index_t capacity)
+: c_s(capacity, capacity), k(0)
+{
+}
+
+template <template <class> class Regularizer, typename T>
+IncrementalRegularizer<Regularizer, T>::~IncrementalRegularizer()
+{
+}
+
+template <template <class> class Regularizer, typename T>
+void IncrementalRegularizer<Regularizer, T>::set_params(typename
+		IncrementalRegularizer<Regularizer, T>::param_type _params)
+{
+	regularizer.set_params(_params);
+}
+
+template <template <class> class Regularizer, typename T>
+void IncrementalRegularizer<Regularizer, T>::clear()
+{
+	k = 0;
+}
+
+template <template <class> class Regularizer, typename T>
+index_t IncrementalRegularizer<Regularizer, T>::size() const
+{
+	return k;
+}
+
+template <template <class> class Regularizer, typename T>
+const T IncrementalRegularizer<Regularizer, T>::extension(Eigen::Ref<Vector<T>> cross,
+		T diag) const
+{
+	// gather the bordered matrix into a workspace owned by the calling thread
+	static thread_local Matrix<T> workspace;
+	if (workspace.rows() < k + 1)
+		workspace.resize(c_s.rows() + 1, c_s.rows() + 1);
+
+	workspace.topLeftCorner(k, k) = c_s.topLeftCorner(k, k);
+	workspace.col(k).head(k) = cross.head(k);
+	workspace.row(k).head(k) = cross.head(k).transpose();
+	workspace(k, k) = diag;
+
+	return regularizer(workspace.topLeftCorner(k + 1, k + 1));
+}
+
+template <template <class> class Regularizer, typename T>
+void IncrementalRegularizer<Regularizer, T>::extensions(Eigen::Ref<Matrix<T>> cross,
+		const Eigen::Ref<const Vector<T>>& diag, Eigen::Ref<Vector<T>> values) const
+{
+	// the regularizer is evaluated from scratch anyway, so one at a time
+	for (index_t c = 0; c < cross.cols(); ++c)
+	{
+		values[c] = extension(cross.col(c), diag[c]);
+	}
+}
+
+template <template <class> class Regularizer, typename T>
+void IncrementalRegularizer<Regularizer, T>::add(Eigen::Ref<Vector<T>> cross, T diag)
+{
+	// grow the storage geometrically if we run out of reserved memory
+	if (k >= c_s.rows())
+	{
+		index_t capacity = std::max<index_t>(2 * c_s.rows(), 1);
+		c_s.conservativeResize(capacity, capacity);
+	}
+
+	c_s.col(k).head(k) = cross.head(k);
+	c_s.row(k).head(k) = cross.head(k).transpose();
+	c_s(k, k) = diag;
+	k++;
+}
+
+template <template <class> class Regularizer, typename T>
+const T IncrementalRegularizer<Regularizer, T>::removal(index_t i,
+		const Eigen::Ref<const Vector<T>>& cross) const
+{
+	assert(i < k);
+
+	// gather C_S without row and column i into a workspace owned by the calling thread
+	static thread_local Matrix<T> workspace;
+	if (workspace.rows() < k)
+		workspace.resize(c_s.rows(), c_s.rows());
+
+	index_t m = k - i - 1;
+	workspace.topLeftCorner(i, i) = c_s.topLeftCorner(i, i);
+	workspace.block(i, 0, m, i) = c_s.block(i + 1, 0, m, i);
+	workspace.block(0, i, i, m) = c_s.block(0, i + 1, i, m);
+	workspace.block(i, i, m, m) = c_s.block(i + 1, i + 1, m, m);
+
+	return regularizer(workspace.topLeftCorner(k - 1, k - 1));
+}
+
+template <template <class> class Regularizer, typename T>
+void IncrementalRegularizer<Regularizer, T>::remove(index_t i,
+		const Eigen::Ref<const Vector<T>>& cross)
+{
+	assert(i < k);
+
+	// move the rows below i one up and the columns right of i one left
+	for (index_t r = i; r + 1 < k; ++r)
+	{
+		c_s.row(r).head(k) = c_s.row(r + 1).head(k);
+	}
+	for (index_t c = i; c + 1 < k; ++c)
+	{
+		c_s.col(c).head(k - 1) = c_s.col(c + 1).head(k - 1);
+	}
+	k--;
+}
+
+template <template <class> class Regularizer, typename T>
+const T IncrementalRegularizer<Regularizer, T>::value() const
+{
+	return regularizer(c_s.topLeftCorner(k, k));
+}
+
+template <typename T>
+IncrementalRegularizer<DummyRegularizer, T>::IncrementalRegularizer(index_t)
+: k(0)
+{
+}
+
+template <typename T>
+IncrementalRegularizer<DummyRegularizer, T>::~IncrementalRegularizer()
+{
+}
+
+template <typename T>
+void IncrementalRegularizer<DummyRegularizer, T>::set_params(typename
+		IncrementalRegularizer<DummyRegularizer, T>::param_type)
+{
+}
+
+template <typename T>
+void IncrementalRegularizer<DummyRegularizer, T>::clear()
+{
+	k = 0;
+}
+
+template <typename T>
+index_t IncrementalRegularizer<DummyRegularizer, T>::size() const
+{
+	return k;
+}
+
+template <typename T>
+const T IncrementalRegularizer<DummyRegularizer, T>::extension(Eigen::Ref<Vector<T>>,
+		T) const
+{
+	return static_cast<T>(0);
+}
+
+template <typename T>
+void IncrementalRegularizer<DummyRegularizer, T>::extensions(Eigen::Ref<Matrix<T>>,
+		const Eigen::Ref<const Vector<T>>&, Eigen::Ref<Vector<T>> values) const
+{
+	values.setZero();
+}
+
+template <typename T>
+void IncrementalRegularizer<DummyRegularizer, T>::add(Eigen::Ref<Vector<T>>, T)
+{
+	k++;
+}
+
+template <typename T>
+const T IncrementalRegularizer<DummyRegularizer, T>::removal(index_t,
+		const Eigen::Ref<const Vector<T>>&) const
+{
+	return static_cast<T>(0);
+}
+
+template <typename T>
+void IncrementalRegularizer<DummyRegularizer, T>::remove(index_t,
+		const Eigen::Ref<const Vector<T>>&)
+{
+	k--;
+}
+
+template <typename T>
+const T IncrementalRegularizer<DummyRegularizer, T>::value() const
+{
+	return static_cast<T>(0);
+}
+
+template <typename T>
+IncrementalRegularizer<SmoothedDifferentialEntropy, T>::IncrementalRegularizer(index_t capacity)
+: chol(capacity), log_det(0)
+{
+}
+
+template <typename T>
+IncrementalRegularizer<SmoothedDifferentialEntropy, T>::~IncrementalRegularizer()
+{
+}
+
+template <typename T>
+void IncrementalRegularizer<SmoothedDifferentialEntropy, T>::set_params(typename
+		IncrementalRegularizer<SmoothedDifferentialEntropy, T>::param_type _params)
+{
+	params = _params;
+	clear();
+}
+
+template <typename T>
+void IncrementalRegularizer<SmoothedDifferentialEntropy, T>::clear()
+{
+	chol.clear();
+	log_det = 0;
+}
+
+template <typename T>
+index_t IncrementalRegularizer<SmoothedDifferentialEntropy, T>::size() const
+{
+	return chol.size();
+}
+
+template <typename T>
+const T IncrementalRegularizer<SmoothedDifferentialEntropy, T>::extension(
+		Eigen::Ref<Vector<T>> cross, T diag) const
+{
+	T d_sq = chol.pivot(cross, diag + params.delta);
+	return value(log_det + log(d_sq), chol.size() + 1);
+}
+
+template <typename T>
+void IncrementalRegularizer<SmoothedDifferentialEntropy, T>::extensions(
+		Eigen::Ref<Matrix<T>> cross, const Eigen::Ref<const Vector<T>>& diag,
+		Eigen::Ref<Vector<T>> values) const
+{
+	// one triangular solve for all the candidates
+	chol.forward_solve_columns(cross);
+
+	index_t k = chol.size();
+	for (index_t c = 0; c < cross.cols(); ++c)
+	{
+		T d_sq = diag[c] + params.delta - cross.col(c).head(k).squaredNorm();
+		values[c] = value(log_det + log(d_sq), k + 1);
+	}
+}
+
+template <typename T>
+void IncrementalRegularizer<SmoothedDifferentialEntropy, T>::add(Eigen::Ref<Vector<T>> cross,
+		T diag)
+{
+	T d_sq = chol.pivot(cross, diag + params.delta);
+	chol.extend(cross, d_sq);
+	log_det += log(d_sq);
+}
+
+template <typename T>
+const T IncrementalRegularizer<SmoothedDifferentialEntropy, T>::removal(index_t i,
+		const Eigen::Ref<const Vector<T>>&) const
+{
+	return value(log_det - log(chol.removal_pivot(i)), chol.size() - 1);
+}
+
+template <typename T>
+void IncrementalRegularizer<SmoothedDifferentialEntropy, T>::remove(index_t i,
+		const Eigen::Ref<const Vector<T>>&)
+{
+	log_det -= log(chol.removal_pivot(i));
+	chol.remove(i);
+}
+
+template <typename T>
+const T IncrementalRegularizer<SmoothedDifferentialEntropy, T>::value() const
+{
+	return value(log_det, chol.size());
+}
+
+template <typename T>
+const T IncrementalRegularizer<SmoothedDifferentialEntropy, T>::value(T _log_det,
+		index_t k) const
+{
+	T inv_log_2 = static_cast<T>(1.0 / log(2));
+	return _log_det * inv_log_2 - 3 * k * log(params.delta) * inv_log_2;
+}
+
+template <typename T>
+IncrementalRegularizer<SpectralVariance, T>::IncrementalRegularizer(index_t)
+: sq_dev(0), k(0)
+{
+}
+
+template <typename T>
+IncrementalRegularizer<SpectralVariance, T>::~IncrementalRegularizer()
+{
+}
+
+template <typename T>
+void IncrementalRegularizer<SpectralVariance, T>::set_params(typename
+		IncrementalRegularizer<SpectralVariance, T>::param_type)
+{
+}
+
+template <typename T>
+void IncrementalRegularizer<SpectralVariance, T>::clear()
+{
+	sq_dev = 0;
+	k = 0;
+}
+
+template <typename T>
+index_t IncrementalRegularizer<SpectralVariance, T>::size() const
+{
+	return k;
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::extension(Eigen::Ref<Vector<T>> cross,
+		T diag) const
+{
+	return value(sq_dev + increment(cross, diag), k + 1);
+}
+
+template <typename T>
+void IncrementalRegularizer<SpectralVariance, T>::extensions(Eigen::Ref<Matrix<T>> cross,
+		const Eigen::Ref<const Vector<T>>& diag, Eigen::Ref<Vector<T>> values) const
+{
+	for (index_t c = 0; c < cross.cols(); ++c)
+	{
+		values[c] = value(sq_dev + increment(cross.col(c), diag[c]), k + 1);
+	}
+}
+
+template <typename T>
+void IncrementalRegularizer<SpectralVariance, T>::add(Eigen::Ref<Vector<T>> cross, T diag)
+{
+	sq_dev += increment(cross, diag);
+	k++;
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::removal(index_t i,
+		const Eigen::Ref<const Vector<T>>& cross) const
+{
+	return value(sq_dev - decrement(i, cross), k - 1);
+}
+
+template <typename T>
+void IncrementalRegularizer<SpectralVariance, T>::remove(index_t i,
+		const Eigen::Ref<const Vector<T>>& cross)
+{
+	sq_dev -= decrement(i, cross);
+	k--;
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::value() const
+{
+	return value(sq_dev, k);
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::increment(
+		const Eigen::Ref<const Vector<T>>& cross, T diag) const
+{
+	// the cross covariance appears twice in C_{S+j} because of symmetry
+	return 2 * cross.head(k).squaredNorm() + diag * diag - 2 * diag;
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::decrement(index_t i,
+		const Eigen::Ref<const Vector<T>>& cross) const
+{
+	assert(i < k);
+
+	// the same as the increment of adding it to S without i
+	T diag = cross[i];
+	return 2 * (cross.head(k).squaredNorm() - diag * diag) + diag * diag - 2 * diag;
+}
+
+template <typename T>
+const T IncrementalRegularizer<SpectralVariance, T>::value(T _sq_dev, index_t _k) const
+{
+	return 9 * _k * _k - (_sq_dev + _k);
+}
+
+template class IncrementalRegularizer<DummyRegularizer, float64_t>;
+template class IncrementalRegularizer<SmoothedDifferentialEntropy, float64_t>;
+template class IncrementalRegularizer<SpectralVariance, float64_t>;
+
+template class IncrementalRegularizer<DummyRegularizer, float32_t>;
+template class IncrementalRegularizer<SmoothedDifferentialEntropy, float32_t>;
+template class IncrementalRegularizer<SpectralVariance, float32_t>;
@@ -0,0 +1,303 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014 Soumyajit De
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef INCREMENTAL_REGULARIZER_H__
+#define INCREMENTAL_REGULARIZER_H__
+
+#include <tesseract/base/types.h>
+#include <tesseract/computation/IncrementalCholesky.hpp>
+#include <tesseract/regularizer/DummyRegularizer.hpp>
+#include <tesseract/regularizer/SmoothedDifferentialEntropy.hpp>
+#include <tesseract/regularizer/SpectralVariance.hpp>
+
+namespace tesseract
+{
+
+/** @brief template class IncrementalRegularizer for evaluating a regularizer
+ * \f$f(C_{S\cup\{j\}})\f$ on the extensions of a growing set \f$S\f$. An
+ * extension is specified by the cross covariance \f$C_{S,j}\f$ (in the order
+ * in which the features were added) and the variance \f$C_{jj}\f$. Features
+ * can also be removed from \f$S\f$, which is specified by their position in
+ * that order and their column of \f$C_S\f$.
+ *
+ * This generic version keeps \f$C_S\f$ and evaluates the regularizer on the
+ * bordered matrix. Regularizers which admit cheaper updates are specialized.
+ */
+template <template <class> class Regularizer, typename T>
+class IncrementalRegularizer
+{
+public:
+	/** param type */
+	typedef typename Regularizer<T>::param_type param_type;
+
+	/** constructor
+	 * @param capacity the expected maximum size of the set \f$S\f$
+	 */
+	IncrementalRegularizer(index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalRegularizer();
+
+	/** @param _params the regularizer params */
+	void set_params(param_type _params);
+
+	/** resets the set \f$S\f$ to the empty set */
+	void clear();
+
+	/** @return the size of the set \f$S\f$ */
+	index_t size() const;
+
+	/**
+	 * @param cross the cross covariance \f$C_{S,j}\f$ (used as scratch memory,
+	 * contents are undefined on exit)
+	 * @param diag the variance \f$C_{jj}\f$
+	 * @return the regularizer value \f$f(C_{S\cup\{j\}})\f$
+	 */
+	const T extension(Eigen::Ref<Vector<T>> cross, T diag) const;
+
+	/** evaluates the extensions by a batch of candidates at once
+	 * @param cross the cross covariances \f$C_{S,j}\f$ of the candidates as
+	 * columns (used as scratch memory, contents are undefined on exit)
+	 * @param diag the variances \f$C_{jj}\f$ of the candidates
+	 * @param values the regularizer values \f$f(C_{S\cup\{j\}})\f$ on exit
+	 */
+	void extensions(Eigen::Ref<Matrix<T>> cross, const Eigen::Ref<const Vector<T>>& diag,
+			Eigen::Ref<Vector<T>> values) const;
+
+	/** adds a feature to the set \f$S\f$
+	 * @param cross the cross covariance \f$C_{S,j}\f$ (used as scratch memory)
+	 * @param diag the variance \f$C_{jj}\f$
+	 */
+	void add(Eigen::Ref<Vector<T>> cross, T diag);
+
+	/**
+	 * @param i the position of the feature in the order of addition
+	 * @param cross the column of \f$C_S\f$ of the feature, in the order of
+	 * addition
+	 * @return the regularizer value \f$f(C_{S\setminus\{i\}})\f$
+	 */
+	const T removal(index_t i, const Eigen::Ref<const Vector<T>>& cross) const;
+
+	/** removes a feature from the set \f$S\f$, the later features move one
+	 * position up in the order of addition
+	 * @param i the position of the feature in the order of addition
+	 * @param cross the column of \f$C_S\f$ of the feature, in the order of
+	 * addition
+	 */
+	void remove(index_t i, const Eigen::Ref<const Vector<T>>& cross);
+
+	/** @return the regularizer value \f$f(C_S)\f$ */
+	const T value() const;
+
+private:
+	/** the regularizer */
+	Regularizer<T> regularizer;
+
+	/** storage of \f$C_S\f$, only the top-left size() x size() part is in use */
+	Matrix<T> c_s;
+
+	/** size of the set \f$S\f$ */
+	index_t k;
+};
+
+/** @brief specialization of IncrementalRegularizer for the dummy regularizer
+ * which is always 0.
+ */
+template <typename T>
+class IncrementalRegularizer<DummyRegularizer, T>
+{
+public:
+	/** param type */
+	typedef DummyRegularizerParam param_type;
+
+	/** constructor */
+	IncrementalRegularizer(index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalRegularizer();
+
+	/** @param _params the regularizer params */
+	void set_params(param_type _params);
+
+	/** resets the set \f$S\f$ to the empty set */
+	void clear();
+
+	/** @return the size of the set \f$S\f$ */
+	index_t size() const;
+
+	/** @return the regularizer value (always 0) */
+	const T extension(Eigen::Ref<Vector<T>> cross, T diag) const;
+
+	/** sets all the regularizer values to 0 */
+	void extensions(Eigen::Ref<Matrix<T>> cross, const Eigen::Ref<const Vector<T>>& diag,
+			Eigen::Ref<Vector<T>> values) const;
+
+	/** adds a feature to the set \f$S\f$ */
+	void add(Eigen::Ref<Vector<T>> cross, T diag);
+
+	/** @return the regularizer value (always 0) */
+	const T removal(index_t i, const Eigen::Ref<const Vector<T>>& cross) const;
+
+	/** removes a feature from the set \f$S\f$ */
+	void remove(index_t i, const Eigen::Ref<const Vector<T>>& cross);
+
+	/** @return the regularizer value (always 0) */
+	const T value() const;
+
+private:
+	/** size of the set \f$S\f$ */
+	index_t k;
+};
+
+/** @brief specialization of IncrementalRegularizer for the smoothed differential
+ * entropy. Since \f$\sum_i\log(\delta+\lambda_i(C_S))=\log\det(C_S+\delta I)\f$,
+ * it keeps the Cholesky factor \f$LL^T=C_S+\delta I\f$ and an extension costs
+ * one triangular solve, \f$\log\det\f$ grows by \f$\log(C_{jj}+\delta-l^Tl)\f$
+ * where \f$l=L^{-1}C_{S,j}\f$. A removal shrinks it by the log of the pivot
+ * which the feature would have if it was added last.
+ */
+template <typename T>
+class IncrementalRegularizer<SmoothedDifferentialEntropy, T>
+{
+public:
+	/** param type */
+	typedef SmoothedDifferentialEntropyParam<T> param_type;
+
+	/** constructor
+	 * @param capacity the expected maximum size of the set \f$S\f$
+	 */
+	IncrementalRegularizer(index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalRegularizer();
+
+	/** @param _params the regularizer params (resets the set \f$S\f$) */
+	void set_params(param_type _params);
+
+	/** resets the set \f$S\f$ to the empty set */
+	void clear();
+
+	/** @return the size of the set \f$S\f$ */
+	index_t size() const;
+
+	/** @see IncrementalRegularizer::extension */
+	const T extension(Eigen::Ref<Vector<T>> cross, T diag) const;
+
+	/** @see IncrementalRegularizer::extensions */
+	void extensions(Eigen::Ref<Matrix<T>> cross, const Eigen::Ref<const Vector<T>>& diag,
+			Eigen::Ref<Vector<T>> values) const;
+
+	/** @see IncrementalRegularizer::add */
+	void add(Eigen::Ref<Vector<T>> cross, T diag);
+
+	/** @see IncrementalRegularizer::removal */
+	const T removal(index_t i, const Eigen::Ref<const Vector<T>>& cross) const;
+
+	/** @see IncrementalRegularizer::remove */
+	void remove(index_t i, const Eigen::Ref<const Vector<T>>& cross);
+
+	/** @return the regularizer value \f$f(C_S)\f$ */
+	const T value() const;
+
+private:
+	/** @return the regularizer value for given \f$\log\det\f$ and size */
+	const T value(T log_det, index_t k) const;
+
+	/** the regularizer params */
+	param_type params;
+
+	/** the Cholesky factor of \f$C_S+\delta I\f$ */
+	IncrementalCholesky<T> chol;
+
+	/** \f$\log\det(C_S+\delta I)\f$ */
+	T log_det;
+};
+
+/** @brief specialization of IncrementalRegularizer for the spectral variance.
+ * It keeps \f$\|C_S\|_F^2-2\,\mathrm{tr}(C_S)\f$ which grows by
+ * \f$2\|C_{S,j}\|^2+C_{jj}^2-2C_{jj}\f$ on adding a feature and shrinks by the
+ * same on removing it, i.e. an extension or a removal costs \f$O(k)\f$.
+ */
+template <typename T>
+class IncrementalRegularizer<SpectralVariance, T>
+{
+public:
+	/** param type */
+	typedef SpectralVarianceParam<T> param_type;
+
+	/** constructor */
+	IncrementalRegularizer(index_t capacity = 0);
+
+	/** destructor */
+	~IncrementalRegularizer();
+
+	/** @param _params the regularizer params */
+	void set_params(param_type _params);
+
+	/** resets the set \f$S\f$ to the empty set */
+	void clear();
+
+	/** @return the size of the set \f$S\f$ */
+	index_t size() const;
+
+	/** @see IncrementalRegularizer::extension */
+	const T extension(Eigen::Ref<Vector<T>> cross, T diag) const;
+
+	/** @see IncrementalRegularizer::extensions */
+	void extensions(Eigen::Ref<Matrix<T>> cross, const Eigen::Ref<const Vector<T>>& diag,
+			Eigen::Ref<Vector<T>> values) const;
+
+	/** @see IncrementalRegularizer::add */
+	void add(Eigen::Ref<Vector<T>> cross, T diag);
+
+	/** @see IncrementalRegularizer::removal */
+	const T removal(index_t i, const Eigen::Ref<const Vector<T>>& cross) const;
+
+	/** @see IncrementalRegularizer::remove */
+	void remove(index_t i, const Eigen::Ref<const Vector<T>>& cross);
+
+	/** @return the regularizer value \f$f(C_S)\f$ */
+	const T value() const;
+
+private:
+	/** @return the change of \f$\|C_S\|_F^2-2\,\mathrm{tr}(C_S)\f$ on adding j */
+	const T increment(const Eigen::Ref<const Vector<T>>& cross, T diag) const;
+
+	/** @return the change of \f$\|C_S\|_F^2-2\,\mathrm{tr}(C_S)\f$ on removing i */
+	const T decrement(index_t i, const Eigen::Ref<const Vector<T>>& cross) const;
+
+	/** @return the regularizer value for given deviation and size */
+	const T value(T _sq_dev, index_t _k) const;
+
+	/** \f$\|C_S\|_F^2-2\,\mathrm{tr}(C_S)\f$ */
+	T sq_dev;
+
+	/** size of the set \f$S\f$ */
+	index_t k;
+};
+
+}
+
+#endif // INCREMENTAL_REGULARIZER_H__
@@ -52,11 +52,24 @@ SmoothedDifferentialEntropy<T>::~SmoothedDifferentialEntropy()
 template <typename T>
 const T SmoothedDifferentialEntropy<T>::operator()(const Eigen::Ref<const Matrix<T>>& cov) const
 {
-	// compute the eigen values
+	index_t k = cov.rows();
+	T inv_log_2 = static_cast<T>(1.0 / log(2));
+
+	// sum of log(delta+lambda_i) is the log determinant of C+delta*I which
+	// is positive definite for a covariance matrix and thus has a Cholesky
+	Matrix<T> smoothed = cov;
+	smoothed.diagonal().array() += params.delta;
+	Eigen::LLT<Matrix<T>> llt(smoothed);
+
+	if (llt.info() == Eigen::Success)
+	{
+		T log_det = 2 * llt.matrixLLT().diagonal().array().log().sum();
+		return log_det * inv_log_2 - 3 * k * log(params.delta) * inv_log_2;
+	}
+
+	// fall back to the eigen values for matrices which aren't positive semi-definite
 	Vector<T> eigenvalues = cov.eigenvalues().real();
-	index_t k = eigenvalues.rows();
 
-	T inv_log_2 = static_cast<T>(1.0 / log(2));
 	std::for_each(eigenvalues.data(), eigenvalues.data() + k, [this, inv_log_2](T& val)
 	{
 		val = log(this->params.delta + val) * inv_log_2;
@@ -74,3 +87,6 @@ void SmoothedDifferentialEntropy<T>::set_params(typename
 
 template class SmoothedDifferentialEntropyParam<float64_t>;
 template class SmoothedDifferentialEntropy<float64_t>;
+
+template class SmoothedDifferentialEntropyParam<float32_t>;
+template class SmoothedDifferentialEntropy<float32_t>;
@@ -23,6 +23,7 @@
  */
 
 #include <tesseract/regularizer/SpectralVariance.hpp>
+#include <algorithm>
 #include <cmath>
 
 using namespace tesseract;
@@ -39,9 +40,21 @@ SpectralVariance<T>::~SpectralVariance()
 
 template <typename T>
 const T SpectralVariance<T>::operator()(const Eigen::Ref<const Matrix<T>>& cov) const
+{
+	index_t k = cov.rows();
+
+	// sum of (lambda_i-1)^2 from the Frobenius norm and the trace
+	T sq_dev = cov.squaredNorm() - 2 * cov.trace() + k;
+
+	return 9 * k * k - sq_dev;
+}
+
+template <typename T>
+const T SpectralVariance<T>::eigen_value(const Eigen::Ref<const Matrix<T>>& cov) const
 {
 	// compute the eigen values
-	Vector<T> eigenvalues = cov.eigenvalues().real();
+	Eigen::SelfAdjointEigenSolver<Matrix<T>> solver(cov, Eigen::EigenvaluesOnly);
+	Vector<T> eigenvalues = solver.eigenvalues();
 	index_t k = eigenvalues.rows();
 
 	std::for_each(eigenvalues.data(), eigenvalues.data() + k, [](T& val)
@@ -61,3 +74,6 @@ void SpectralVariance<T>::set_params(typename
 
 template class SpectralVarianceParam<float64_t>;
 template class SpectralVariance<float64_t>;
+
+template class SpectralVarianceParam<float32_t>;
+template class SpectralVariance<float32_t>;
@@ -36,7 +36,10 @@ struct SpectralVarianceParam
 {
 };
 
-/** @brief class SpectralVariance
+/** @brief class SpectralVariance for computing the spectral variance
+ * \f$9k^2-\sum_{i=1}^{k}{(\lambda_i(C_S)-1)^2}\f$. Since \f$C_S\f$ is symmetric,
+ * \f$\sum_{i=1}^{k}{(\lambda_i(C_S)-1)^2}=\|C_S\|_F^2-2\,\mathrm{tr}(C_S)+k\f$
+ * which is computed without any decomposition.
  */
 template <typename T>
 struct SpectralVariance
@@ -56,6 +59,12 @@ struct SpectralVariance
 	 */
 	const T operator()(const Eigen::Ref<const Matrix<T>>& cov) const;
 
+	/** reference implementation of operator() using the eigen values
+	 * @param cov the covariance matrix
+	 * @return the regularizer value
+	 */
+	const T eigen_value(const Eigen::Ref<const Matrix<T>>& cov) const;
+
 	/** @param _param the regularizer param */
 	void set_params(param_type _params);
 